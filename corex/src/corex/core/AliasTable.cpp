@@ -0,0 +1,136 @@
+#include <cassert>
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+#include <pcg_random.hpp>
+
+#include <corex/core/AliasTable.hpp>
+#include <corex/core/utils.hpp>
+
+namespace corex::core
+{
+  AliasTable::AliasTable()
+    : columns()
+    , scaledWeights()
+    , smallIndexes()
+    , largeIndexes() {}
+
+  AliasTable::AliasTable(const eastl::vector<float>& weights)
+    : AliasTable()
+  {
+    this->build(weights);
+  }
+
+  void AliasTable::build(const float* weights, int32_t numWeights)
+  {
+    assert(numWeights > 0);
+
+    this->columns.resize(numWeights);
+    this->scaledWeights.resize(numWeights);
+    this->smallIndexes.clear();
+    this->largeIndexes.clear();
+
+    // Sum in double so that lots of small weights don't get lost.
+    double weightSum = 0.0;
+    for (int32_t i = 0; i < numWeights; i++) {
+      assert(weights[i] >= 0.f);
+      weightSum += weights[i];
+    }
+    assert(weightSum > 0.0);
+
+    // Scale the weights so that the average weight is 1.
+    const double scale = numWeights / weightSum;
+    for (int32_t i = 0; i < numWeights; i++) {
+      this->scaledWeights[i] = static_cast<float>(weights[i] * scale);
+      if (this->scaledWeights[i] < 1.f) {
+        this->smallIndexes.push_back(i);
+      } else {
+        this->largeIndexes.push_back(i);
+      }
+    }
+
+    while (!this->smallIndexes.empty() && !this->largeIndexes.empty()) {
+      int32_t smallIndex = this->smallIndexes.back();
+      int32_t largeIndex = this->largeIndexes.back();
+      this->smallIndexes.pop_back();
+
+      this->columns[smallIndex] = Column{
+        this->scaledWeights[smallIndex],
+        largeIndex
+      };
+
+      // The large item gives away some of its weight to fill up the small
+      // item's column.
+      this->scaledWeights[largeIndex] = (this->scaledWeights[largeIndex]
+                                         + this->scaledWeights[smallIndex])
+                                        - 1.f;
+      if (this->scaledWeights[largeIndex] < 1.f) {
+        this->largeIndexes.pop_back();
+        this->smallIndexes.push_back(largeIndex);
+      }
+    }
+
+    // Whatever is left should have a weight of 1. Those that are not are only
+    // off due to rounding errors.
+    for (int32_t largeIndex : this->largeIndexes) {
+      this->columns[largeIndex] = Column{ 1.f, largeIndex };
+    }
+
+    for (int32_t smallIndex : this->smallIndexes) {
+      this->columns[smallIndex] = Column{ 1.f, smallIndex };
+    }
+  }
+
+  void AliasTable::build(const eastl::vector<float>& weights)
+  {
+    this->build(weights.data(), weights.size());
+  }
+
+  int32_t AliasTable::sample() const
+  {
+    return this->sample(getRandomNumberGenerator());
+  }
+
+  int32_t AliasTable::sample(pcg32& rng) const
+  {
+    assert(!this->isEmpty());
+
+    // Pick a column using the full 32 bits of a draw, and then flip a biased
+    // coin using the top 24 bits of another draw. 24 bits is all a float's
+    // mantissa can hold anyway.
+    const uint64_t numColumns = this->columns.size();
+    const int32_t column = static_cast<int32_t>(
+      (static_cast<uint64_t>(rng()) * numColumns) >> 32);
+    const float coin = static_cast<float>(rng() >> 8) * (1.f / 16777216.f);
+
+    const Column& selectedColumn = this->columns[column];
+
+    return (coin < selectedColumn.probability) ? column : selectedColumn.alias;
+  }
+
+  void AliasTable::sample(int32_t numSamples,
+                          eastl::vector<int32_t>& sampledIndexes) const
+  {
+    this->sample(numSamples, sampledIndexes, getRandomNumberGenerator());
+  }
+
+  void AliasTable::sample(int32_t numSamples,
+                          eastl::vector<int32_t>& sampledIndexes,
+                          pcg32& rng) const
+  {
+    sampledIndexes.resize(numSamples);
+    for (int32_t i = 0; i < numSamples; i++) {
+      sampledIndexes[i] = this->sample(rng);
+    }
+  }
+
+  int32_t AliasTable::size() const
+  {
+    return this->columns.size();
+  }
+
+  bool AliasTable::isEmpty() const
+  {
+    return this->columns.empty();
+  }
+}
@@ -0,0 +1,64 @@
+#ifndef COREX_CORE_ALIAS_TABLE_HPP
+#define COREX_CORE_ALIAS_TABLE_HPP
+
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+#include <pcg_random.hpp>
+
+namespace corex::core
+{
+  // Samples indexes according to a set of weights in O(1) time per sample,
+  // using Vose's variant of Walker's alias method. Building the table takes
+  // O(n) time. Rebuilding an existing table reuses its memory, so weights that
+  // change every iteration (e.g. fitness-based selection weights) can be
+  // rebuilt without allocating every time.
+  //
+  // Refer to: https://www.keithschwarz.com/darts-dice-coins/
+  class AliasTable
+  {
+  public:
+    AliasTable();
+    explicit AliasTable(const eastl::vector<float>& weights);
+
+    // Weights must be non-negative, and at least one of them must be
+    // positive.
+    void build(const float* weights, int32_t numWeights);
+    void build(const eastl::vector<float>& weights);
+
+    // Uses the random number generator of the calling thread.
+    int32_t sample() const;
+    int32_t sample(pcg32& rng) const;
+    void sample(int32_t numSamples,
+                eastl::vector<int32_t>& sampledIndexes) const;
+    void sample(int32_t numSamples,
+                eastl::vector<int32_t>& sampledIndexes,
+                pcg32& rng) const;
+
+    int32_t size() const;
+    bool isEmpty() const;
+
+  private:
+    // The probability and alias of a column are stored together, since a
+    // sample needs both.
+    struct Column
+    {
+      float probability;
+      int32_t alias;
+    };
+
+    eastl::vector<Column> columns;
+
+    // Scratch buffers used when building the table.
+    eastl::vector<float> scaledWeights;
+    eastl::vector<int32_t> smallIndexes;
+    eastl::vector<int32_t> largeIndexes;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -1,8 +1,11 @@
 #include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 
+#include <EASTL/sort.h>
 #include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
 #include <entt/entt.hpp>
 #include <GL/glew.h>
 #include <imgui.h>
@@ -15,8 +18,10 @@
 
 #include <corex/core/AssetManager.hpp>
 #include <corex/core/Application.hpp>
+#include <corex/core/LaunchOptions.hpp>
 #include <corex/core/math_functions.hpp>
 #include <corex/core/PerformanceMetrics.hpp>
+#include <corex/core/RenderMode.hpp>
 #include <corex/core/SceneManager.hpp>
 #include <corex/core/SceneManagerStatus.hpp>
 #include <corex/core/Timer.hpp>
@@ -24,25 +29,56 @@
 #include <corex/core/components/Position.hpp>
 #include <corex/core/components/Renderable.hpp>
 #include <corex/core/components/RenderCircle.hpp>
+#include <corex/core/components/RenderGeometryCache.hpp>
+#include <corex/core/components/RenderImage.hpp>
+#include <corex/core/components/RenderPointCloud.hpp>
 #include <corex/core/components/RenderableType.hpp>
-#include <corex/core/components/RenderLineSegments.hpp>
 #include <corex/core/components/RenderPolygon.hpp>
 #include <corex/core/components/RenderRectangle.hpp>
 #include <corex/core/components/Sprite.hpp>
 #include <corex/core/components/Text.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
 #include <corex/core/ds/Polygon.hpp>
+#include <corex/core/events/capture_events.hpp>
 #include <corex/core/events/game_events.hpp>
 #include <corex/core/events/metric_events.hpp>
 #include <corex/core/events/scene_manager_events.hpp>
 #include <corex/core/events/sys_events.hpp>
+#include <corex/core/memory/allocation_tracking.hpp>
+#include <corex/core/memory/LinearArena.hpp>
+#include <corex/core/memory/memory_functions.hpp>
+#include <corex/core/renderer/CircleBatch.hpp>
+#include <corex/core/renderer/FrameCapture.hpp>
+#include <corex/core/renderer/GlyphAtlas.hpp>
+#include <corex/core/renderer/GPUContextLock.hpp>
+#include <corex/core/renderer/ImageUpdateQueue.hpp>
+#include <corex/core/renderer/LineBatch.hpp>
+#include <corex/core/renderer/NullRenderBackend.hpp>
+#include <corex/core/renderer/RenderBackend.hpp>
+#include <corex/core/renderer/RenderCommandFile.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+#include <corex/core/renderer/RenderQueue.hpp>
+#include <corex/core/renderer/RenderThread.hpp>
+#include <corex/core/renderer/SDLGPURenderBackend.hpp>
 
 namespace corex::core
 {
   Application::Application(const eastl::string& windowTitle)
-    : sceneManager(nullptr)
+    : launchOptions(getLaunchOptions())
+    , sceneManager(nullptr)
     , assetManager(nullptr)
     , registry() // Nothing to do to initialize the EnTT registry. Just adding
                  // this here for sake of consistency.
+    , renderQueue(registry)
+    , circleBatch()
+    , lineBatch(registry)
+    , frameCapture()
+    , renderCommandList()
+    , renderThread(nullptr)
+    , renderBackend(nullptr)
+    , commandFileWriter()
+    , commandFileReader()
     , eventDispatcher() // For sake of consistency, as well.
     , camera()
     , settings()
@@ -50,11 +86,16 @@ namespace corex::core
     , keyboardHandler(eventDispatcher)
     , mouseHandler(eventDispatcher)
     , spritesheetAnimation(eventDispatcher, registry)
+    , renderGeometryCacher(eventDispatcher, registry)
     , debugUI(eventDispatcher, camera)
-    , windowManager(windowTitle, eventDispatcher, settings)
+    , windowManager(windowTitle,
+                    eventDispatcher,
+                    settings,
+                    launchOptions.renderMode)
     , gameTimeWarpFactor(1.0f)
     , imGuiFilePath()
     , isGamePlaying(true)
+    , prevAllocationStats()
   {
     // TODO: Get window settings from a settings module.
     if (SDL_Init(SDL_INIT_TIMER) != 0) {
@@ -101,6 +142,28 @@ namespace corex::core
     io.DisplaySize.x = windowWidth;
     io.DisplaySize.y = windowHeight;
     io.IniFilename = this->imGuiFilePath.c_str();
+    if (isHeadless(this->launchOptions)) {
+      // Don't mess with the window layout of the interactive runs.
+      io.IniFilename = nullptr;
+    }
+
+    if (this->launchOptions.renderMode == RenderMode::NULL_RENDERER) {
+      this->renderBackend = eastl::make_unique<NullRenderBackend>();
+    } else {
+      this->renderBackend = eastl::make_unique<SDLGPURenderBackend>(
+        this->windowManager.getRenderTarget());
+    }
+
+    if (!this->launchOptions.commandRecordingPath.empty()) {
+      this->commandFileWriter.open(this->launchOptions.commandRecordingPath);
+    }
+
+    const eastl::string& replayPath = this->launchOptions.commandReplayPath;
+    if (!replayPath.empty() && this->commandFileReader.open(replayPath)) {
+      // Images aren't recorded, so blits and textured triangles get skipped.
+      std::cout << "Replaying render commands. Text and sprites won't be "
+                << "drawn, since images aren't recorded." << std::endl;
+    }
 
     // Set up the managers.
     this->assetManager = eastl::make_unique<AssetManager>();
@@ -117,6 +180,12 @@ namespace corex::core
                             this);
     this->eventDispatcher.sink<WindowEvent>()
                          .connect<&Application::handleWindowEvents>(this);
+    this->eventDispatcher.sink<FrameCaptureStartEvent>()
+                         .connect<&Application::handleFrameCaptureStartEvents>(
+                            this);
+    this->eventDispatcher.sink<FrameCaptureStopEvent>()
+                         .connect<&Application::handleFrameCaptureStopEvents>(
+                            this);
   }
 
   Application::~Application()
@@ -126,6 +195,7 @@ namespace corex::core
     ImPlot::DestroyContext();
     ImGui::DestroyContext();
 
+    clearGlyphAtlases();
     TTF_Quit();
     SDL_Quit();
   }
@@ -139,15 +209,47 @@ namespace corex::core
     Timer gameTimer;
     Timer appTimer;
 
+    // In headless mode, the game runs at a fixed time step for a set number of
+    // frames, and we keep the time each frame took for the frame time report.
+    const bool isRunHeadless = isHeadless(this->launchOptions);
+    eastl::vector<double> frameTimes;
+    if (isRunHeadless) {
+      frameTimes.reserve(this->launchOptions.numFrames);
+    }
+
+    if (this->launchOptions.renderThreadPipelineDepth > 0) {
+      // ImGui creates its OpenGL objects in its first NewFrame() call. That
+      // happens on this thread, so they have to be created before the context
+      // gets handed over to the render thread.
+      ImGui_ImplOpenGL3_CreateDeviceObjects();
+
+      RenderThread::FrameExecutor frameExecutor;
+      frameExecutor.connect<&Application::executeFrame>(this);
+      this->renderThread = eastl::make_unique<RenderThread>(
+        this->windowManager.getWindow(),
+        this->windowManager.getOpenGLContext(),
+        this->launchOptions.renderThreadPipelineDepth,
+        frameExecutor);
+      this->renderThread->start();
+    }
+
     appTimer.start();
     gameTimer.start();
     while (true) {
+      // Anything allocated from the frame arena in the previous frame should
+      // not be used anymore.
+      getFrameArena().reset();
+
       this->runEventSystems();
 
       // We prep the rendering before the scene updates, because the scene
       // might draw something.
       this->renderPrep();
-      this->sceneManager->update(metrics.timeDelta);
+
+      {
+        COREX_ALLOCATION_SCOPE("Scene Update");
+        this->sceneManager->update(metrics.timeDelta);
+      }
 
       if (this->sceneManager->getStatus() == SceneManagerStatus::DONE) {
         break;
@@ -156,7 +258,10 @@ namespace corex::core
       this->render();
 
       // Do performance-related tasks.
-      metrics.timeDelta = gameTimer.getElapsedTime()
+      const double gameTimeDelta = isRunHeadless
+                                   ? this->launchOptions.fixedTimeStep
+                                   : gameTimer.getElapsedTime();
+      metrics.timeDelta = gameTimeDelta
                           * this->gameTimeWarpFactor
                           * this->isGamePlaying;
       metrics.appTimeDelta = appTimer.getElapsedTime();
@@ -165,6 +270,30 @@ namespace corex::core
 
       this->computePerformanceMetrics(metrics);
       this->dispatchPerformanceMetrics(metrics);
+#ifdef COREX_TRACK_ALLOCATIONS
+      this->dispatchAllocationMetrics();
+#endif
+
+      if (isRunHeadless) {
+        frameTimes.push_back(metrics.appTimeDelta);
+        if (this->launchOptions.numFrames > 0
+            && metrics.numFrames >= this->launchOptions.numFrames) {
+          break;
+        }
+      }
+    }
+
+    // Draw the frames still in the pipeline, and get the OpenGL context back.
+    if (this->renderThread) {
+      this->renderThread->stop();
+    }
+
+    // Make sure every captured frame gets written before we leave.
+    this->frameCapture.stop();
+    this->commandFileWriter.close();
+
+    if (isRunHeadless) {
+      this->writeFrameTimeReport(frameTimes);
     }
 
     this->dispose();
@@ -200,12 +329,105 @@ namespace corex::core
                                                   metrics.appTimeDelta);
   }
 
+  void Application::dispatchAllocationMetrics()
+  {
+    AllocationDataEvent e;
+    e.numTags = getNumAllocationTags();
+    for (int32_t i = 0; i < e.numTags; i++) {
+      AllocationStats stats = getAllocationStats(i);
+      e.tags[i] = AllocationTagData{
+        getAllocationTagName(i),
+        stats,
+        stats.numAllocations - this->prevAllocationStats[i].numAllocations,
+        stats.numBytesAllocated
+          - this->prevAllocationStats[i].numBytesAllocated
+      };
+
+      this->prevAllocationStats[i] = stats;
+    }
+
+    this->eventDispatcher.enqueue<AllocationDataEvent>(e);
+  }
+
+  void Application::dispatchRenderMetrics(
+    const RenderCommandList& commandList)
+  {
+    const int32_t numRenderables = this->renderQueue.size();
+    const int32_t numVisibleRenderables = this->renderQueue
+                                              .getNumVisibleItems();
+    this->eventDispatcher.enqueue<RenderDataEvent>(
+      numRenderables,
+      numVisibleRenderables,
+      numRenderables - numVisibleRenderables,
+      commandList.getNumCommands(),
+      commandList.getNumMergedCommands());
+  }
+
   void Application::dispatchSceneManagerEvents()
   {
     this->eventDispatcher.enqueue<PPMRatioChange>(
       this->sceneManager->getCurrentScenePPMRatio());
   }
 
+  void Application::writeFrameTimeReport(
+    const eastl::vector<double>& frameTimes)
+  {
+    if (frameTimes.empty()) {
+      std::cout << "No frames were run. Skipping the frame time report."
+                << std::endl;
+      return;
+    }
+
+    eastl::vector<double> sortedFrameTimes = frameTimes;
+    eastl::sort(sortedFrameTimes.begin(), sortedFrameTimes.end());
+
+    const int32_t numFrames = sortedFrameTimes.size();
+    auto getPercentile = [&sortedFrameTimes, numFrames](double percentile) {
+      const int32_t index = static_cast<int32_t>(percentile * (numFrames - 1));
+      return sortedFrameTimes[index] * 1000.0;
+    };
+
+    double totalTime = 0.0;
+    for (double frameTime : frameTimes) {
+      totalTime += frameTime;
+    }
+
+    std::ofstream reportFile(
+      eaStrToStdStr(this->launchOptions.frameTimeReportPath),
+      std::ofstream::trunc);
+
+    int64_t numSkippedCommands = 0;
+    int64_t numSkippedVertices = 0;
+    if (this->launchOptions.renderMode == RenderMode::NULL_RENDERER) {
+      const auto& nullRenderBackend = static_cast<const NullRenderBackend&>(
+        *(this->renderBackend));
+      numSkippedCommands = nullRenderBackend.getNumCommands();
+      numSkippedVertices = nullRenderBackend.getNumVertices();
+    }
+
+    // Everything is in milliseconds.
+    reportFile << "# No. of Frames: " << numFrames << "\n"
+               << "# Mean: " << (totalTime / numFrames) * 1000.0 << "\n"
+               << "# Min: " << getPercentile(0.0) << "\n"
+               << "# Median: " << getPercentile(0.5) << "\n"
+               << "# 95th Percentile: " << getPercentile(0.95) << "\n"
+               << "# 99th Percentile: " << getPercentile(0.99) << "\n"
+               << "# Max: " << getPercentile(1.0) << "\n"
+               << "# No. of Skipped Draw Commands: "
+               << numSkippedCommands << "\n"
+               << "# No. of Skipped Vertices: " << numSkippedVertices << "\n"
+               << "frame,frame_time_ms\n";
+    for (int32_t i = 0; i < numFrames; i++) {
+      reportFile << i << "," << frameTimes[i] * 1000.0 << "\n";
+    }
+
+    std::cout << "Ran " << numFrames << " frames headlessly. Mean frame time: "
+              << (totalTime / numFrames) * 1000.0 << " ms, 99th percentile: "
+              << getPercentile(0.99) << " ms. Wrote the frame time report to "
+              << eaStrToStdStr(this->launchOptions.frameTimeReportPath)
+              << "." << std::endl;
+  }
+
   void Application::computePerformanceMetrics(PerformanceMetrics& metrics)
   {
     metrics.numFrames++;
@@ -230,6 +452,26 @@ namespace corex::core
     metrics.fps = static_cast<int32_t>(totalAvgFps);
   }
 
+  void Application::handleFrameCaptureStartEvents(
+    const FrameCaptureStartEvent& e)
+  {
+    if (this->launchOptions.renderMode == RenderMode::NULL_RENDERER) {
+      std::cout << "Nothing gets drawn with the null renderer. Frames will not "
+                << "be captured." << std::endl;
+      return;
+    }
+
+    GPUContextLock contextLock;
+    this->frameCapture.start(e.outputFolder, e.format);
+  }
+
+  void Application::handleFrameCaptureStopEvents(
+    const FrameCaptureStopEvent& e)
+  {
+    GPUContextLock contextLock;
+    this->frameCapture.stop();
+  }
+
   void Application::handleGameTimeWarpEvents(const GameTimeWarpEvent& e)
   {
     this->gameTimeWarpFactor = e.timeWarpFactor;
@@ -253,42 +495,101 @@ namespace corex::core
 
   void Application::renderPrep()
   {
-    // Render time!
-    GPU_ClearRGBA(this->windowManager.getRenderTarget(), 115, 140, 153, 255);
-    GPU_SetCamera(this->windowManager.getRenderTarget(),
-                  this->camera.getGPUCamera());
-
     // Start the Dear ImGui frame.
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplSDL2_NewFrame(this->windowManager.getWindow());
     ImGui::NewFrame();
   }
 
+  void Application::captureFrame()
+  {
+    // SDL_gpu batches blits, so everything has to be submitted before we read
+    // the frame back.
+    GPU_FlushBlitBuffer();
+
+    int32_t drawableWidth = 0;
+    int32_t drawableHeight = 0;
+    SDL_GL_GetDrawableSize(this->windowManager.getWindow(),
+                           &drawableWidth,
+                           &drawableHeight);
+
+    this->frameCapture.captureFrame(drawableWidth, drawableHeight);
+  }
+
   void Application::render()
   {
-    // Sort the renderables first.
-    auto renderGroup = this->registry.group<Position, Renderable>();
-    renderGroup.sort([this](const entt::entity lhs, const entt::entity rhs) {
-      const Position& lhsPos = this->registry.get<Position>(lhs);
-      const Position& rhsPos = this->registry.get<Position>(rhs);
-
-      return (lhsPos.sortingLayerID < rhsPos.sortingLayerID)
-        || ((lhsPos.sortingLayerID == rhsPos.sortingLayerID)
-            && (lhsPos.z < rhsPos.z));
-    });
-
-    for (entt::entity e : renderGroup) {
+    COREX_ALLOCATION_SCOPE("Render");
+
+    // With a render thread, this waits if the pipeline is full.
+    RenderCommandList& commandList = this->renderThread
+                                     ? this->renderThread->beginFrame()
+                                     : this->renderCommandList;
+    if (!this->renderThread) {
+      commandList.clear();
+    }
+
+    if (this->commandFileReader.isOpen()) {
+      this->replayRenderCommands(commandList);
+    } else {
+      this->recordRenderCommands(commandList);
+      commandList.mergeCommands();
+    }
+
+    this->commandFileWriter.writeFrame(commandList);
+    this->dispatchRenderMetrics(commandList);
+
+    this->debugUI.render();
+
+    ImGui::Render();
+    commandList.setImGuiDrawData(ImGui::GetDrawData());
+
+    // Capture before the UI gets drawn, so that it doesn't end up in the
+    // frames.
+    commandList.setFrameCaptured(this->frameCapture.isCapturing());
+
+    if (this->renderThread) {
+      this->renderThread->submitFrame(commandList);
+    } else {
+      this->executeFrame(commandList);
+    }
+  }
+
+  void Application::recordRenderCommands(RenderCommandList& commandList)
+  {
+    // Images have to be updated before anything gets drawn with them.
+    getImageUpdateQueue().record(commandList);
+
+    this->renderGeometryCacher.update();
+    this->circleBatch.begin(commandList);
+    this->lineBatch.update();
+
+    commandList.addClear(SDL_Color{ 115, 140, 153, 255 });
+    commandList.addSetCamera(*(this->camera.getGPUCamera()));
+
+    GPU_Target* renderTarget = this->windowManager.getRenderTarget();
+    const AABB viewBounds = this->camera.getViewAABB(renderTarget->w,
+                                                     renderTarget->h);
+
+    // The render queue only re-sorts the renderables when their draw order
+    // changes, and only gives us the ones that are within the camera's view.
+    for (const RenderQueue::Item& item : this->renderQueue.update(viewBounds)) {
+      const entt::entity e = item.entity;
       const Position& pos = this->registry.get<Position>(e);
       const Renderable& renderable = this->registry.get<Renderable>(e);
 
+      // Filled circles, including the ones in point clouds, are batched.
+      // Record the pending ones before recording anything else so that the
+      // draw order is kept.
+      if (renderable.type != RenderableType::PRIMITIVE_CIRCLE
+          && renderable.type != RenderableType::POINT_CLOUD) {
+        this->circleBatch.flush();
+      }
+
       switch (renderable.type) {
         case RenderableType::TEXT: {
+          // Texts that share a font get merged into one draw call.
           const Text& text = this->registry.get<Text>(e);
-          GPU_Blit(text.getRenderableText(),
-                   nullptr,
-                   this->windowManager.getRenderTarget(),
-                   pos.x,
-                   pos.y);
+          text.record(commandList, pos.x, pos.y);
         } break;
         case RenderableType::SPRITE: {
           const Sprite& sprite = this->registry.get<Sprite>(e);
@@ -305,112 +606,127 @@ namespace corex::core
             static_cast<float>(sprite.width),
             static_cast<float>(sprite.height)
           };
-          GPU_BlitRect(sprite.texture.get(),
-                       &renderRect,
-                       this->windowManager.getRenderTarget(),
-                       &targetRect);
+          commandList.addBlit(sprite.texture.get(), renderRect, targetRect);
         } break;
         case RenderableType::PRIMITIVE_RECTANGLE: {
           const RenderRectangle& rect = this->registry.get<RenderRectangle>(e);
-          Polygon<4> rotatedRect = rotateRectangle(rect.x,
-                                                   rect.y,
-                                                   rect.width,
-                                                   rect.height,
-                                                   rect.angle);
-
-          // vertices will has 8 elements because it will contain the x and y
-          // coordinates of the rectangle that will be drawn.
-          float vertices[8] = {
-            rotatedRect.vertices[0].x, rotatedRect.vertices[0].y,
-            rotatedRect.vertices[1].x, rotatedRect.vertices[1].y,
-            rotatedRect.vertices[2].x, rotatedRect.vertices[2].y,
-            rotatedRect.vertices[3].x, rotatedRect.vertices[3].y
-          };
-
-          if (rect.isFilled) {
-            GPU_PolygonFilled(this->windowManager.getRenderTarget(),
-                              4,
-                              vertices,
-                              rect.colour);
-          } else {
-            // TODO: Add a debug mode where a polygon is not filled.
-            GPU_Polygon(this->windowManager.getRenderTarget(),
-                        4,
-                        vertices,
-                        rect.colour);
-          }
+          auto& geometry = this->registry.get<RenderGeometryCache>(e);
 
+          // TODO: Add a debug mode where a polygon is not filled.
+          commandList.addPolygon(geometry.vertices.data(),
+                                 4,
+                                 rect.colour,
+                                 rect.isFilled);
         } break;
         case RenderableType::PRIMITIVE_POLYGON: {
           const RenderPolygon& poly = this->registry.get<RenderPolygon>(e);
+          auto& geometry = this->registry.get<RenderGeometryCache>(e);
+          int32_t numVertices = geometry.vertices.size() / 2;
 
-          int32_t numVertices = poly.vertices.size();
-          float vertices[numVertices * 2];
-          for (int32_t i = 0; i < numVertices; i++) {
-            int32_t vertXIndex = i * 2;
-            int32_t vertYIndex = vertXIndex + 1;
-            vertices[vertXIndex] = poly.vertices[i].x;
-            vertices[vertYIndex] = poly.vertices[i].y;
-          }
-
-          if (poly.isFilled) {
-            GPU_PolygonFilled(this->windowManager.getRenderTarget(),
-                              numVertices,
-                              vertices,
-                              poly.colour);
-          } else {
-            GPU_Polygon(this->windowManager.getRenderTarget(),
-                        numVertices,
-                        vertices,
-                        poly.colour);
-          }
+          commandList.addPolygon(geometry.vertices.data(),
+                                 numVertices,
+                                 poly.colour,
+                                 poly.isFilled);
         } break;
         case RenderableType::LINE_SEGMENTS: {
-          const RenderLineSegments& segments = this->registry
-                                                    .get<RenderLineSegments>(e);
-
-          if (segments.vertices.size() <= 1) {
-            // Not enough vertices to form a line. 
-            continue;
-          }
-
-          for (int32_t i = 0; i < segments.vertices.size() - 1; i++) {
-            GPU_Line(this->windowManager.getRenderTarget(),
-                     segments.vertices[i].x,
-                     segments.vertices[i].y,
-                     segments.vertices[i + 1].x,
-                     segments.vertices[i + 1].y,
-                     segments.colour);
-          }
+          // Line segments are batched by sorting layer, z, and colour, so
+          // only the first entity in a batch actually records anything.
+          this->lineBatch.record(commandList, e);
         } break;
         case RenderableType::PRIMITIVE_CIRCLE: {
           const RenderCircle& circle = this->registry.get<RenderCircle>(e);
 
           if (circle.isFilled) {
-            GPU_CircleFilled(this->windowManager.getRenderTarget(),
-                             pos.x,
-                             pos.y,
-                             circle.radius,
-                             circle.colour);
+            this->circleBatch.add(pos.x, pos.y, circle.radius, circle.colour);
           } else {
-            GPU_Circle(this->windowManager.getRenderTarget(),
-                       pos.x,
-                       pos.y,
-                       circle.radius,
-                       circle.colour);
+            this->circleBatch.flush();
+            commandList.addCircle(pos.x, pos.y, circle.radius, circle.colour);
+          }
+        } break;
+        case RenderableType::IMAGE: {
+          const RenderImage& image = this->registry.get<RenderImage>(e);
+          if (!image.image) {
+            break;
+          }
+
+          commandList.addBlit(
+            image.image.get(),
+            GPU_Rect{ 0.f,
+                      0.f,
+                      static_cast<float>(image.image->w),
+                      static_cast<float>(image.image->h) },
+            GPU_Rect{ pos.x - (image.width / 2.f),
+                      pos.y - (image.height / 2.f),
+                      image.width,
+                      image.height });
+        } break;
+        case RenderableType::POINT_CLOUD: {
+          const auto& cloud = this->registry.get<RenderPointCloud>(e);
+          if (cloud.history == nullptr
+              || cloud.frameIndex < 0
+              || cloud.frameIndex >= cloud.history->getNumFrames()) {
+            break;
+          }
+
+          // The points are read straight from the history. Points whose
+          // circles are outside of the view get skipped.
+          const AABB cloudViewBounds{
+            viewBounds.minPt - Point{ cloud.radius, cloud.radius },
+            viewBounds.maxPt + Point{ cloud.radius, cloud.radius }
+          };
+          const Point* points = cloud.history->getFrame(cloud.frameIndex);
+          const int32_t numPoints = cloud.history->getNumPoints();
+          for (int32_t i = cloud.firstPointIndex; i < numPoints; i++) {
+            if (isPointWithinAABB(points[i], cloudViewBounds)) {
+              this->circleBatch.add(points[i].x,
+                                    points[i].y,
+                                    cloud.radius,
+                                    cloud.colour);
+            }
           }
         } break;
       }
     }
 
-    //GPU_FlushBlitBuffer();
+    this->circleBatch.flush();
+  }
 
-    this->debugUI.render();
+  void Application::replayRenderCommands(RenderCommandList& commandList)
+  {
+    if (this->commandFileReader.readFrame(commandList)) {
+      return;
+    }
+
+    // Loop back to the first frame once we run out of frames.
+    this->commandFileReader.rewind();
+    if (!this->commandFileReader.readFrame(commandList)) {
+      std::cout << "Unable to read the recorded render commands. Stopping the "
+                << "replay." << std::endl;
+      this->commandFileReader.close();
+      this->recordRenderCommands(commandList);
+      commandList.mergeCommands();
+    }
+  }
+
+  void Application::executeFrame(RenderCommandList& commandList)
+  {
+    // Runs on the render thread, if there is one.
+    commandList.execute(*(this->renderBackend));
+
+    if (this->launchOptions.renderMode == RenderMode::NULL_RENDERER) {
+      // The null backend only keeps count of what would've been drawn.
+      return;
+    }
+
+    if (commandList.isFrameCaptured()) {
+      this->captureFrame();
+    }
 
-    ImGui::Render();
     SDL_GL_MakeCurrent(this->windowManager.getWindow(),
                        this->windowManager.getOpenGLContext());
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    if (ImDrawData* drawData = commandList.getImGuiDrawData()) {
+      ImGui_ImplOpenGL3_RenderDrawData(drawData);
+    }
 
     GPU_Flip(this->windowManager.getRenderTarget());
   }
@@ -1,8 +1,10 @@
 #ifndef COREX_CORE_APPLICATION_HPP
 #define COREX_CORE_APPLICATION_HPP
 
+#include <EASTL/array.h>
 #include <EASTL/string.h>
 #include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
 #include <entt/entt.hpp>
 #include <SDL2/SDL.h>
 #include <SDL_gpu.h>
@@ -10,14 +12,26 @@
 #include <corex/core/AssetManager.hpp>
 #include <corex/core/Camera.hpp>
 #include <corex/core/DebugUI.hpp>
+#include <corex/core/LaunchOptions.hpp>
 #include <corex/core/PerformanceMetrics.hpp>
 #include <corex/core/SceneManager.hpp>
 #include <corex/core/Settings.hpp>
 #include <corex/core/WindowManager.hpp>
+#include <corex/core/events/capture_events.hpp>
 #include <corex/core/events/game_events.hpp>
 #include <corex/core/events/sys_events.hpp>
+#include <corex/core/memory/allocation_tracking.hpp>
+#include <corex/core/renderer/CircleBatch.hpp>
+#include <corex/core/renderer/FrameCapture.hpp>
+#include <corex/core/renderer/LineBatch.hpp>
+#include <corex/core/renderer/RenderBackend.hpp>
+#include <corex/core/renderer/RenderCommandFile.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+#include <corex/core/renderer/RenderQueue.hpp>
+#include <corex/core/renderer/RenderThread.hpp>
 #include <corex/core/systems/KeyboardHandler.hpp>
 #include <corex/core/systems/MouseHandler.hpp>
+#include <corex/core/systems/RenderGeometryCacher.hpp>
 #include <corex/core/systems/SpritesheetAnimation.hpp>
 #include <corex/core/systems/SysEventDispatcher.hpp>
 
@@ -36,6 +50,7 @@ namespace corex::core
 
   protected:
     SDL_GLContext glContext; // NOTE: SDL_GLContext is an alias for void*.
+    LaunchOptions launchOptions;
 
     // We're using unique pointers here to scene manager and asset manager
     // since we can't initialize them prior to execution of the constructor
@@ -47,11 +62,21 @@ namespace corex::core
     eastl::unique_ptr<AssetManager> assetManager;
 
     entt::registry registry;
+    RenderQueue renderQueue;
+    CircleBatch circleBatch;
+    LineBatch lineBatch;
+    FrameCapture frameCapture;
+    RenderCommandList renderCommandList; // Used if there's no render thread.
+    eastl::unique_ptr<RenderThread> renderThread;
+    eastl::unique_ptr<RenderBackend> renderBackend;
+    RenderCommandFileWriter commandFileWriter;
+    RenderCommandFileReader commandFileReader;
     entt::dispatcher eventDispatcher;
     SysEventDispatcher sysEventDispatcher;
     KeyboardHandler keyboardHandler;
     MouseHandler mouseHandler;
     SpritesheetAnimation spritesheetAnimation;
+    RenderGeometryCacher renderGeometryCacher;
     Camera camera;
     DebugUI debugUI;
     Settings settings;
@@ -61,16 +86,29 @@ namespace corex::core
     eastl::string imGuiFilePath;
 
   private:
+    // Allocation stats at the end of the previous frame. Only used when
+    // allocation tracking is on.
+    eastl::array<AllocationStats, maxNumAllocationTags> prevAllocationStats;
+
     void displayGraphicsAPIInfo();
     void runEventSystems();
     void dispatchPerformanceMetrics(PerformanceMetrics& metrics);
+    void dispatchAllocationMetrics();
+    void dispatchRenderMetrics(const RenderCommandList& commandList);
     void dispatchSceneManagerEvents();
+    void writeFrameTimeReport(const eastl::vector<double>& frameTimes);
     void computePerformanceMetrics(PerformanceMetrics& metrics);
+    void handleFrameCaptureStartEvents(const FrameCaptureStartEvent& e);
+    void handleFrameCaptureStopEvents(const FrameCaptureStopEvent& e);
     void handleGameTimeWarpEvents(const GameTimeWarpEvent& e);
     void handleGameTimerStatusEvents(const GameTimerStatusEvent& e);
     void handleWindowEvents(const WindowEvent& e);
     void renderPrep();
+    void captureFrame();
     void render();
+    void recordRenderCommands(RenderCommandList& commandList);
+    void replayRenderCommands(RenderCommandList& commandList);
+    void executeFrame(RenderCommandList& commandList);
   };
 }
 
@@ -20,7 +20,9 @@
 #include <corex/core/asset_types/SpritesheetData.hpp>
 #include <corex/core/asset_types/SpritesheetState.hpp>
 #include <corex/core/asset_types/Texture.hpp>
+#include <corex/core/sdl_deleters.hpp>
 #include <corex/core/utils.hpp>
+#include <corex/core/renderer/GPUContextLock.hpp>
 
 namespace corex::core
 {
@@ -91,8 +93,8 @@ namespace corex::core
         STUBBED("We should check if image exists.");
         eastl::string texturePath = iter->second.filePath;
         GPU_Image* texture = this->loadTexture(texturePath);
-        eastl::get<Texture>(iter->second.data).reset(
-          texture, [](GPU_Image* texture) { GPU_FreeImage(texture); });
+        eastl::get<Texture>(iter->second.data).reset(texture,
+                                                     SDLGPUImageDeleter());
       }
     } else {
       std::cout << "Attempted to get a texture asset with an invalid ID, "
@@ -170,9 +172,7 @@ namespace corex::core
 
         // Save the data.
         iter->second.data = SpritesheetData{
-          eastl::shared_ptr<GPU_Image>(
-            spritesheetImage,
-            [](GPU_Image* texture) { GPU_FreeImage(texture); }),
+          eastl::shared_ptr<GPU_Image>(spritesheetImage, SDLGPUImageDeleter()),
           timePerFrame,
           frames,
           customStates
@@ -241,6 +241,7 @@ namespace corex::core
 
   GPU_Image* AssetManager::loadTexture(eastl::string texturePath)
   {
+    GPUContextLock contextLock;
     return GPU_LoadImage(texturePath.c_str());
   }
 }
@@ -1,11 +1,17 @@
+#include <algorithm>
 #include <assert.h>
+#include <cmath>
 #include <cstdlib>
+#include <limits>
 
 #include <EASTL/unique_ptr.h>
 #include <SDL_gpu.h>
 
 #include <corex/core/Camera.hpp>
 #include <corex/core/CameraZoomState.hpp>
+#include <corex/core/math_functions.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
 
 namespace corex::core
 {
@@ -155,4 +161,69 @@ namespace corex::core
         break;
     }
   }
+
+  AABB Camera::getViewAABB(float viewportWidth, float viewportHeight)
+  {
+    const GPU_Camera& cam = *(this->gpuCamera);
+    if (cam.zoom_x == 0.f || cam.zoom_y == 0.f) {
+      // Everything gets squished into a line or a point. Just treat the
+      // whole world as visible.
+      constexpr float inf = std::numeric_limits<float>::infinity();
+      return AABB{ Point{ -inf, -inf }, Point{ inf, inf } };
+    }
+
+    const Point corners[4] = {
+      Point{ 0.f, 0.f },
+      Point{ viewportWidth, 0.f },
+      Point{ viewportWidth, viewportHeight },
+      Point{ 0.f, viewportHeight }
+    };
+
+    AABB viewAABB{
+      Point{ std::numeric_limits<float>::max(),
+             std::numeric_limits<float>::max() },
+      Point{ std::numeric_limits<float>::lowest(),
+             std::numeric_limits<float>::lowest() }
+    };
+    for (const Point& corner : corners) {
+      const Point worldPt = this->screenToWorld(corner,
+                                                viewportWidth,
+                                                viewportHeight);
+
+      viewAABB.minPt.x = std::min(viewAABB.minPt.x, worldPt.x);
+      viewAABB.minPt.y = std::min(viewAABB.minPt.y, worldPt.y);
+      viewAABB.maxPt.x = std::max(viewAABB.maxPt.x, worldPt.x);
+      viewAABB.maxPt.y = std::max(viewAABB.maxPt.y, worldPt.y);
+    }
+
+    return viewAABB;
+  }
+
+  Point Camera::screenToWorld(const Point& screenPt,
+                              float viewportWidth,
+                              float viewportHeight)
+  {
+    const GPU_Camera& cam = *(this->gpuCamera);
+    assert(cam.zoom_x != 0.f && cam.zoom_y != 0.f);
+
+    // SDL_gpu transforms a world point, p, into a screen point, s, with:
+    //
+    //   s = R(Z(p - c)) + c - cam
+    //
+    // where R rotates by the camera angle, Z scales by the zoom, c is the
+    // center of the viewport, and cam is the camera position. We undo that
+    // transform here.
+    const float centerX = viewportWidth / 2.f;
+    const float centerY = viewportHeight / 2.f;
+    const float angle = degreesToRadians(cam.angle);
+    const float cosAngle = std::cos(angle);
+    const float sinAngle = std::sin(angle);
+    const float x = screenPt.x + cam.x - centerX;
+    const float y = screenPt.y + cam.y - centerY;
+    const float unrotatedX = (x * cosAngle) + (y * sinAngle);
+    const float unrotatedY = (y * cosAngle) - (x * sinAngle);
+
+    return Point{ centerX + (unrotatedX / cam.zoom_x),
+                  centerY + (unrotatedY / cam.zoom_y) };
+  }
 }
@@ -7,6 +7,8 @@
 #include <SDL_gpu.h>
 
 #include <corex/core/CameraZoomState.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
 
 namespace corex::core
 {
@@ -46,6 +48,16 @@ namespace corex::core
     void moveY(float delta);
     void zoom(CameraZoomState state);
 
+    // Returns the world-space bounds of the area the camera sees in a
+    // viewport with the given size, taking the zoom and angle into account.
+    AABB getViewAABB(float viewportWidth, float viewportHeight);
+
+    // Converts a point on the screen to where it is in the world, taking the
+    // zoom and angle into account. The zoom must not be zero.
+    Point screenToWorld(const Point& screenPt,
+                        float viewportWidth,
+                        float viewportHeight);
+
   private:
     float zoomXDelta;
     float zoomYDelta;
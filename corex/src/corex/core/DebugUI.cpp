@@ -14,6 +14,7 @@
 #include <corex/core/events/MouseMovementEvent.hpp>
 #include <corex/core/events/MouseScrollEvent.hpp>
 #include <corex/core/events/scene_manager_events.hpp>
+#include <corex/core/memory/allocation_tracking.hpp>
 #include <corex/core/systems/MouseButtonState.hpp>
 #include <corex/core/systems/MouseButtonType.hpp>
 
@@ -24,11 +25,15 @@ namespace corex::core
   DebugUI::DebugUI(entt::dispatcher& eventDispatcher, Camera& camera)
     : eventDispatcher(eventDispatcher)
     , metrics()
+    , allocationData()
+    , renderData()
     , camera(camera)
     , isFreeFlyEnabled(false)
     , isDebugUIDisplayed(false)
     , isCameraControlsDisplayed(false)
     , isPerformanceMetricsDisplayed(false)
+    , isAllocationMetricsDisplayed(false)
+    , isRenderMetricsDisplayed(false)
     , isTimeControlsDisplayed(false)
     , isMouseDebugDisplayed(false)
     , isGamePlaying(true)
@@ -43,6 +48,10 @@ namespace corex::core
   {
     this->eventDispatcher.sink<FrameDataEvent>()
                          .connect<&DebugUI::handleFrameDataEvents>(this);
+    this->eventDispatcher.sink<AllocationDataEvent>()
+                         .connect<&DebugUI::handleAllocationDataEvents>(this);
+    this->eventDispatcher.sink<RenderDataEvent>()
+                         .connect<&DebugUI::handleRenderDataEvents>(this);
     this->eventDispatcher.sink<KeyboardEvent>()
                          .connect<&DebugUI::handleKeyboardEvents>(this);
     this->eventDispatcher.sink<MouseScrollEvent>()
@@ -76,6 +85,14 @@ namespace corex::core
         this->buildPerformanceMetrics();
       }
 
+      if (this->isAllocationMetricsDisplayed) {
+        this->buildAllocationMetrics();
+      }
+
+      if (this->isRenderMetricsDisplayed) {
+        this->buildRenderMetrics();
+      }
+
       if (this->isTimeControlsDisplayed) {
         this->buildTimeControls();
       }
@@ -100,6 +117,16 @@ namespace corex::core
           performanceMetricsText.insert(0, "/ ");
         }
 
+        eastl::string allocationMetricsText("Show Allocation Metrics");
+        if (this->isAllocationMetricsDisplayed) {
+          allocationMetricsText.insert(0, "/ ");
+        }
+
+        eastl::string renderMetricsText("Show Render Metrics");
+        if (this->isRenderMetricsDisplayed) {
+          renderMetricsText.insert(0, "/ ");
+        }
+
         eastl::string timeControlsText("Show Time Controls");
         if (this->isTimeControlsDisplayed) {
           timeControlsText.insert(0, "/ ");
@@ -119,6 +146,15 @@ namespace corex::core
             !this->isPerformanceMetricsDisplayed;
         }
 
+        if (ImGui::MenuItem(allocationMetricsText.c_str())) {
+          this->isAllocationMetricsDisplayed =
+            !this->isAllocationMetricsDisplayed;
+        }
+
+        if (ImGui::MenuItem(renderMetricsText.c_str())) {
+          this->isRenderMetricsDisplayed = !this->isRenderMetricsDisplayed;
+        }
+
         if (ImGui::MenuItem(timeControlsText.c_str())) {
           this->isTimeControlsDisplayed = !this->isTimeControlsDisplayed;
         }
@@ -144,6 +180,75 @@ namespace corex::core
     ImGui::End();
   }
 
+  void DebugUI::buildAllocationMetrics()
+  {
+    ImGui::Begin("Allocation Metrics");
+
+    if (!isAllocationTrackingEnabled()) {
+      ImGui::TextUnformatted("Allocation tracking is off. Build with "
+                             "COREX_TRACK_ALLOCATIONS turned on to enable it.");
+      ImGui::End();
+      return;
+    }
+
+    ImGui::Columns(6, "allocationMetricsColumns");
+    ImGui::TextUnformatted("Tag");
+    ImGui::NextColumn();
+    ImGui::TextUnformatted("Allocs/Frame");
+    ImGui::NextColumn();
+    ImGui::TextUnformatted("Bytes/Frame");
+    ImGui::NextColumn();
+    ImGui::TextUnformatted("Total Allocs");
+    ImGui::NextColumn();
+    ImGui::TextUnformatted("Live Bytes");
+    ImGui::NextColumn();
+    ImGui::TextUnformatted("Peak Bytes");
+    ImGui::NextColumn();
+    ImGui::Separator();
+
+    for (int32_t i = 0; i < this->allocationData.numTags; i++) {
+      const AllocationTagData& tagData = this->allocationData.tags[i];
+      ImGui::TextUnformatted(tagData.name);
+      ImGui::NextColumn();
+      ImGui::Text("%llu",
+                  static_cast<unsigned long long>(
+                    tagData.numAllocationsInFrame));
+      ImGui::NextColumn();
+      ImGui::Text("%llu",
+                  static_cast<unsigned long long>(
+                    tagData.numBytesAllocatedInFrame));
+      ImGui::NextColumn();
+      ImGui::Text("%llu",
+                  static_cast<unsigned long long>(
+                    tagData.totalStats.numAllocations));
+      ImGui::NextColumn();
+      ImGui::Text("%lld",
+                  static_cast<long long>(tagData.totalStats.numLiveBytes));
+      ImGui::NextColumn();
+      ImGui::Text("%lld",
+                  static_cast<long long>(tagData.totalStats.peakNumLiveBytes));
+      ImGui::NextColumn();
+    }
+
+    ImGui::Columns(1);
+    ImGui::End();
+  }
+
+  void DebugUI::buildRenderMetrics()
+  {
+    ImGui::Begin("Render Metrics");
+    ImGui::Text("No. of Renderables: %d", this->renderData.numRenderables);
+    ImGui::Text("No. of Visible Renderables: %d",
+                this->renderData.numVisibleRenderables);
+    ImGui::Text("No. of Culled Renderables: %d",
+                this->renderData.numCulledRenderables);
+    ImGui::Text("No. of Render Commands: %d",
+                this->renderData.numRenderCommands);
+    ImGui::Text("No. of Merged Render Commands: %d",
+                this->renderData.numMergedRenderCommands);
+    ImGui::End();
+  }
+
   void DebugUI::buildCameraControls()
   {
     ImGui::Begin("Camera Controls");
@@ -250,6 +355,16 @@ namespace corex::core
     };
   }
 
+  void DebugUI::handleAllocationDataEvents(const AllocationDataEvent& e)
+  {
+    this->allocationData = e;
+  }
+
+  void DebugUI::handleRenderDataEvents(const RenderDataEvent& e)
+  {
+    this->renderData = e;
+  }
+
   void DebugUI::handleKeyboardEvents(const KeyboardEvent& e)
   {
     if (e.keyState == KeyState::KEY_DOWN && e.numRepeats == 0) {
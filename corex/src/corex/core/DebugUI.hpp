@@ -33,12 +33,16 @@ namespace corex::core
   private:
     void buildMenu();
     void buildPerformanceMetrics();
+    void buildAllocationMetrics();
+    void buildRenderMetrics();
     void buildCameraControls();
     void buildTimeControls();
     void buildMouseDebugWindow();
     void dispatchTimeWarpEvents();
     void dispatchGameTimerStatusEvents();
     void handleFrameDataEvents(const FrameDataEvent& e);
+    void handleAllocationDataEvents(const AllocationDataEvent& e);
+    void handleRenderDataEvents(const RenderDataEvent& e);
     void handleKeyboardEvents(const KeyboardEvent& e);
     void handleMouseScrollEvents(const MouseScrollEvent& e);
     void handleMouseMovementEvents(const MouseMovementEvent& e);
@@ -48,11 +52,15 @@ namespace corex::core
 
     entt::dispatcher& eventDispatcher;
     PerformanceMetrics metrics;
+    AllocationDataEvent allocationData;
+    RenderDataEvent renderData;
     Camera& camera;
     bool isFreeFlyEnabled;
     bool isDebugUIDisplayed;
     bool isCameraControlsDisplayed;
     bool isPerformanceMetricsDisplayed;
+    bool isAllocationMetricsDisplayed;
+    bool isRenderMetricsDisplayed;
     bool isTimeControlsDisplayed;
     bool isMouseDebugDisplayed;
     bool isGamePlaying;
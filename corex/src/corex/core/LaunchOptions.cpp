@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <EASTL/string.h>
+
+#include <corex/core/LaunchOptions.hpp>
+#include <corex/core/RenderMode.hpp>
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  LaunchOptions _launchOptions;
+
+  // Returns the argument after the option at index i, or nullptr if there is
+  // none.
+  const char* _getOptionValue(int32_t argc, char** argv, int32_t& i)
+  {
+    if (i + 1 >= argc) {
+      std::cout << "Launch option " << argv[i] << " needs a value. Ignoring it."
+                << std::endl;
+      return nullptr;
+    }
+
+    i++;
+    return argv[i];
+  }
+  /////////////////////////////////////////////////
+
+  LaunchOptions parseLaunchOptions(int32_t argc, char** argv)
+  {
+    LaunchOptions options;
+    for (int32_t i = 1; i < argc; i++) {
+      const char* arg = argv[i];
+      if (std::strcmp(arg, "--headless") == 0
+          || std::strcmp(arg, "--headless=offscreen") == 0) {
+        options.renderMode = RenderMode::OFFSCREEN;
+      } else if (std::strcmp(arg, "--headless=null") == 0) {
+        options.renderMode = RenderMode::NULL_RENDERER;
+      } else if (std::strcmp(arg, "--frames") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.numFrames = std::max(std::atoi(value), 0);
+        }
+      } else if (std::strcmp(arg, "--time-step") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          const float timeStep = std::strtof(value, nullptr);
+          if (timeStep > 0.f) {
+            options.fixedTimeStep = timeStep;
+          }
+        }
+      } else if (std::strcmp(arg, "--report") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.frameTimeReportPath = value;
+        }
+      } else if (std::strcmp(arg, "--render-thread") == 0) {
+        options.renderThreadPipelineDepth = 1;
+      } else if (std::strncmp(arg, "--render-thread=", 16) == 0) {
+        options.renderThreadPipelineDepth = std::max(std::atoi(arg + 16), 1);
+      } else if (std::strcmp(arg, "--capture") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.captureFolder = value;
+        }
+      } else if (std::strcmp(arg, "--capture-format") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          if (std::strcmp(value, "raw") == 0) {
+            options.captureFormat = FrameCaptureFormat::RAW;
+          } else if (std::strcmp(value, "png") == 0) {
+            options.captureFormat = FrameCaptureFormat::PNG;
+          } else {
+            std::cout << "Unknown capture format: " << value
+                      << ". Using png." << std::endl;
+          }
+        }
+      } else if (std::strcmp(arg, "--capture-iterations") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.numCaptureIterations = std::max(std::atoi(value), 0);
+        }
+      } else if (std::strcmp(arg, "--capture-wolves") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.numCaptureWolves = std::max(std::atoi(value), 0);
+        }
+      } else if (std::strcmp(arg, "--record-commands") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.commandRecordingPath = value;
+        }
+      } else if (std::strcmp(arg, "--replay-commands") == 0) {
+        if (const char* value = _getOptionValue(argc, argv, i)) {
+          options.commandReplayPath = value;
+        }
+      } else {
+        std::cout << "Unknown launch option: " << arg << std::endl;
+      }
+    }
+
+    return options;
+  }
+
+  void setLaunchOptions(const LaunchOptions& options)
+  {
+    _launchOptions = options;
+  }
+
+  const LaunchOptions& getLaunchOptions()
+  {
+    return _launchOptions;
+  }
+
+  bool isHeadless(const LaunchOptions& options)
+  {
+    return options.renderMode != RenderMode::WINDOWED;
+  }
+}
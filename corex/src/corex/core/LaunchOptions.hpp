@@ -0,0 +1,72 @@
+#ifndef COREX_CORE_LAUNCH_OPTIONS_HPP
+#define COREX_CORE_LAUNCH_OPTIONS_HPP
+
+#include <cstdint>
+
+#include <EASTL/string.h>
+
+#include <corex/core/RenderMode.hpp>
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
+
+namespace corex::core
+{
+  // Options passed through the command line:
+  //
+  //   --headless[=offscreen|null]  Run without a visible window. Defaults to
+  //                                offscreen.
+  //   --frames <n>                 Number of frames to run in headless mode
+  //                                before quitting. 0 runs until the scenes
+  //                                are done.
+  //   --time-step <seconds>        Fixed time step used in headless mode.
+  //   --report <path>              Where the headless frame time report gets
+  //                                written.
+  //   --capture <folder>           Capture a run's playback as an image
+  //                                sequence into the folder, and quit once
+  //                                done. Works with --headless=offscreen, but
+  //                                pass --frames 0 so the run isn't cut short.
+  //   --capture-format <png|raw>   Format of the captured frames. Defaults to
+  //                                png.
+  //   --capture-iterations <n>     Number of iterations of the run generated
+  //                                for --capture. Defaults to 100.
+  //   --capture-wolves <n>         Number of wolves in the run generated for
+  //                                --capture. Defaults to 25.
+  //   --render-thread[=<depth>]    Draw frames on a separate thread, with up
+  //                                to <depth> frames (1 to 3) in flight.
+  //                                Defaults to 1.
+  //   --record-commands <file>     Record the render commands of every frame
+  //                                into the file.
+  //   --replay-commands <file>     Draw the frames recorded in the file,
+  //                                instead of the scenes, looping once the
+  //                                last frame is reached. Text and sprites
+  //                                are not drawn, since images aren't
+  //                                recorded.
+  struct LaunchOptions
+  {
+    RenderMode renderMode = RenderMode::WINDOWED;
+    int32_t numFrames = 600;
+    float fixedTimeStep = 1.f / 60.f;
+    eastl::string frameTimeReportPath = "frame_times.txt";
+    eastl::string captureFolder = ""; // Empty if frames are not captured.
+    FrameCaptureFormat captureFormat = FrameCaptureFormat::PNG;
+    int32_t numCaptureIterations = 100;
+    int32_t numCaptureWolves = 25;
+    int32_t renderThreadPipelineDepth = 0; // 0 if there's no render thread.
+    eastl::string commandRecordingPath = ""; // Empty if not recording.
+    eastl::string commandReplayPath = ""; // Empty if not replaying.
+  };
+
+  LaunchOptions parseLaunchOptions(int32_t argc, char** argv);
+
+  // The options have to be set before the application gets created, since
+  // the application reads them in its constructor.
+  void setLaunchOptions(const LaunchOptions& options);
+  const LaunchOptions& getLaunchOptions();
+  bool isHeadless(const LaunchOptions& options);
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,237 @@
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/PolygonClipper.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
+#include <corex/core/ds/Rectangle.hpp>
+
+namespace corex::core
+{
+  PolygonClipper::PolygonClipper(const NPolygon& clippingPolygon)
+    : clipVertices()
+    , clipMinPt()
+    , clipMaxPt()
+    , orientation(1.0)
+    , inputBuffer()
+    , outputBuffer()
+  {
+    this->setClippingPolygon(clippingPolygon.vertices.data(),
+                             clippingPolygon.vertices.size());
+  }
+
+  PolygonClipper::PolygonClipper(const Rectangle& clippingRect)
+    : PolygonClipper(convertRectangleToPolygon(clippingRect)) {}
+
+  PolygonClipper::PolygonClipper(const PreparedPolygon& clippingPolygon)
+    : clipVertices(clippingPolygon.polygon.vertices)
+    , clipMinPt(clippingPolygon.bounds.minPt)
+    , clipMaxPt(clippingPolygon.bounds.maxPt)
+    , orientation((clippingPolygon.isCounterclockwise) ? 1.0 : -1.0)
+    , inputBuffer()
+    , outputBuffer()
+  {
+    // No need to set up the clipping polygon since the prepared polygon
+    // already has everything we need.
+    assert(clippingPolygon.isConvex);
+  }
+
+  double PolygonClipper::clip(const Point* vertices,
+                              int32_t numVertices,
+                              eastl::vector<Point>& clippedVertices)
+  {
+    double area = this->clipIntoScratch(vertices, numVertices);
+    clippedVertices.assign(this->inputBuffer.begin(), this->inputBuffer.end());
+
+    return area;
+  }
+
+  double PolygonClipper::clip(const NPolygon& polygon, NPolygon& clippedPolygon)
+  {
+    return this->clip(polygon.vertices.data(),
+                      polygon.vertices.size(),
+                      clippedPolygon.vertices);
+  }
+
+  double PolygonClipper::clip(const Rectangle& rect, NPolygon& clippedPolygon)
+  {
+    return this->clip(convertRectangleToPolygon(rect), clippedPolygon);
+  }
+
+  double PolygonClipper::computeOverlapArea(const NPolygon& polygon)
+  {
+    return this->clipIntoScratch(polygon.vertices.data(),
+                                 polygon.vertices.size());
+  }
+
+  double PolygonClipper::computeOverlapArea(const Rectangle& rect)
+  {
+    Polygon<4> rectPoly = convertRectangleToPolygon(rect);
+    return this->clipIntoScratch(rectPoly.vertices.data(),
+                                 rectPoly.vertices.size());
+  }
+
+  double PolygonClipper::clipRectangles(const eastl::vector<Rectangle>& rects,
+                                        eastl::vector<double>& overlapAreas)
+  {
+    overlapAreas.resize(rects.size());
+
+    double totalOverlapArea = 0.0;
+    for (int32_t i = 0; i < rects.size(); i++) {
+      overlapAreas[i] = this->computeOverlapArea(rects[i]);
+      totalOverlapArea += overlapAreas[i];
+    }
+
+    return totalOverlapArea;
+  }
+
+  double PolygonClipper::clipRectangles(const eastl::vector<Rectangle>& rects,
+                                        eastl::vector<NPolygon>& clippedPolygons,
+                                        eastl::vector<double>& overlapAreas)
+  {
+    // We're resizing instead of clearing so that the vertex buffers of the
+    // clipped polygons from a previous batch can be reused.
+    clippedPolygons.resize(rects.size());
+    overlapAreas.resize(rects.size());
+
+    double totalOverlapArea = 0.0;
+    for (int32_t i = 0; i < rects.size(); i++) {
+      overlapAreas[i] = this->clip(rects[i], clippedPolygons[i]);
+      totalOverlapArea += overlapAreas[i];
+    }
+
+    return totalOverlapArea;
+  }
+
+  const eastl::vector<Point>& PolygonClipper::getClippingPolygonVertices() const
+  {
+    return this->clipVertices;
+  }
+
+  void PolygonClipper::setClippingPolygon(const Point* vertices,
+                                          int32_t numVertices)
+  {
+    assert(numVertices >= 3);
+
+    this->clipVertices.assign(vertices, vertices + numVertices);
+
+    this->clipMinPt = vertices[0];
+    this->clipMaxPt = vertices[0];
+    double signedArea = 0.0;
+    for (int32_t i = 0, j = numVertices - 1; i < numVertices; j = i++) {
+      this->clipMinPt.x = eastl::min(this->clipMinPt.x, vertices[i].x);
+      this->clipMinPt.y = eastl::min(this->clipMinPt.y, vertices[i].y);
+      this->clipMaxPt.x = eastl::max(this->clipMaxPt.x, vertices[i].x);
+      this->clipMaxPt.y = eastl::max(this->clipMaxPt.y, vertices[i].y);
+
+      signedArea += (static_cast<double>(vertices[j].x) * vertices[i].y)
+                    - (static_cast<double>(vertices[i].x) * vertices[j].y);
+    }
+
+    // We need to know the orientation of the clipping polygon so that we know
+    // which side of each clip edge is the inside.
+    this->orientation = (signedArea >= 0.0) ? 1.0 : -1.0;
+  }
+
+  double PolygonClipper::clipIntoScratch(const Point* vertices,
+                                         int32_t numVertices)
+  {
+    this->inputBuffer.clear();
+    if (numVertices < 3 || this->isOutsideClippingBounds(vertices,
+                                                         numVertices)) {
+      return 0.0;
+    }
+
+    this->inputBuffer.assign(vertices, vertices + numVertices);
+
+    const int32_t numClipVertices = this->clipVertices.size();
+    for (int32_t i = 0; i < numClipVertices; i++) {
+      this->clipAgainstEdge(this->clipVertices[i],
+                            this->clipVertices[(i + 1) % numClipVertices],
+                            this->inputBuffer,
+                            this->outputBuffer);
+      eastl::swap(this->inputBuffer, this->outputBuffer);
+
+      if (this->inputBuffer.empty()) {
+        return 0.0;
+      }
+    }
+
+    // Compute the area using the Shoelace algorithm while we have the clipped
+    // polygon in hand.
+    const auto& clipped = this->inputBuffer;
+    double area = 0.0;
+    for (int32_t i = 0, j = clipped.size() - 1; i < clipped.size(); j = i++) {
+      area += (static_cast<double>(clipped[j].x) * clipped[i].y)
+              - (static_cast<double>(clipped[i].x) * clipped[j].y);
+    }
+
+    return std::fabs(area) / 2.0;
+  }
+
+  bool PolygonClipper::isOutsideClippingBounds(const Point* vertices,
+                                               int32_t numVertices) const
+  {
+    Point minPt = vertices[0];
+    Point maxPt = vertices[0];
+    for (int32_t i = 1; i < numVertices; i++) {
+      minPt.x = eastl::min(minPt.x, vertices[i].x);
+      minPt.y = eastl::min(minPt.y, vertices[i].y);
+      maxPt.x = eastl::max(maxPt.x, vertices[i].x);
+      maxPt.y = eastl::max(maxPt.y, vertices[i].y);
+    }
+
+    return maxPt.x < this->clipMinPt.x || minPt.x > this->clipMaxPt.x
+           || maxPt.y < this->clipMinPt.y || minPt.y > this->clipMaxPt.y;
+  }
+
+  void PolygonClipper::clipAgainstEdge(
+    const Point& edgeStart,
+    const Point& edgeEnd,
+    const eastl::vector<Point>& subjectVertices,
+    eastl::vector<Point>& clippedVertices) const
+  {
+    // Heck, yeah! Let's do some Sutherland-Hodgman. Each subject vertex gets
+    // its signed distance (scaled by the edge length) to the clip edge
+    // computed once. The intersection point can be interpolated directly
+    // from those distances, so we don't need to do any line intersection
+    // tests.
+    clippedVertices.clear();
+
+    const double edgeX = static_cast<double>(edgeEnd.x) - edgeStart.x;
+    const double edgeY = static_cast<double>(edgeEnd.y) - edgeStart.y;
+    auto computeSide = [&](const Point& p) -> double {
+      return this->orientation
+             * ((edgeX * (static_cast<double>(p.y) - edgeStart.y))
+                - (edgeY * (static_cast<double>(p.x) - edgeStart.x)));
+    };
+
+    const int32_t numSubjectVertices = subjectVertices.size();
+    Point prevVertex = subjectVertices[numSubjectVertices - 1];
+    double prevSide = computeSide(prevVertex);
+    for (int32_t i = 0; i < numSubjectVertices; i++) {
+      const Point& currVertex = subjectVertices[i];
+      const double currSide = computeSide(currVertex);
+
+      if ((prevSide >= 0.0) != (currSide >= 0.0)) {
+        // The subject edge crosses the clip edge.
+        const float t = static_cast<float>(prevSide / (prevSide - currSide));
+        clippedVertices.push_back(prevVertex + (t * (currVertex - prevVertex)));
+      }
+
+      if (currSide >= 0.0) {
+        clippedVertices.push_back(currVertex);
+      }
+
+      prevVertex = currVertex;
+      prevSide = currSide;
+    }
+  }
+}
@@ -0,0 +1,98 @@
+#ifndef COREX_CORE_POLYGON_CLIPPER_HPP
+#define COREX_CORE_POLYGON_CLIPPER_HPP
+
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
+#include <corex/core/ds/Rectangle.hpp>
+
+namespace corex::core
+{
+  // Clips polygons against a convex clipping polygon using the
+  // Sutherland-Hodgman algorithm. The clipping polygon is set up only once,
+  // so it is meant to be reused for clipping many polygons against the same
+  // polygon (e.g. many building rectangles against one hazard zone). The
+  // scratch buffers are kept between clips, so clipping does not allocate
+  // once the buffers have grown large enough.
+  class PolygonClipper
+  {
+  public:
+    // The clipping polygon must be convex. It can be oriented either way.
+    explicit PolygonClipper(const NPolygon& clippingPolygon);
+    explicit PolygonClipper(const Rectangle& clippingRect);
+    explicit PolygonClipper(const PreparedPolygon& clippingPolygon);
+
+    template <uint32_t numVertices>
+    explicit PolygonClipper(const Polygon<numVertices>& clippingPolygon)
+      : clipVertices()
+      , clipMinPt()
+      , clipMaxPt()
+      , orientation(1.0)
+      , inputBuffer()
+      , outputBuffer()
+    {
+      this->setClippingPolygon(clippingPolygon.vertices.data(), numVertices);
+    }
+
+    // All clip functions return the area of the clipped polygon. The clipped
+    // polygon is empty if the polygons do not overlap.
+    double clip(const Point* vertices,
+                int32_t numVertices,
+                eastl::vector<Point>& clippedVertices);
+    double clip(const NPolygon& polygon, NPolygon& clippedPolygon);
+    double clip(const Rectangle& rect, NPolygon& clippedPolygon);
+
+    template <uint32_t numVertices>
+    double clip(const Polygon<numVertices>& polygon, NPolygon& clippedPolygon)
+    {
+      return this->clip(polygon.vertices.data(),
+                        numVertices,
+                        clippedPolygon.vertices);
+    }
+
+    // Use these when only the area of overlap is needed.
+    double computeOverlapArea(const NPolygon& polygon);
+    double computeOverlapArea(const Rectangle& rect);
+
+    // Batch versions. overlapAreas[i] will hold the area of overlap between
+    // rects[i] and the clipping polygon. The total area of overlap is
+    // returned.
+    double clipRectangles(const eastl::vector<Rectangle>& rects,
+                          eastl::vector<double>& overlapAreas);
+    double clipRectangles(const eastl::vector<Rectangle>& rects,
+                          eastl::vector<NPolygon>& clippedPolygons,
+                          eastl::vector<double>& overlapAreas);
+
+    const eastl::vector<Point>& getClippingPolygonVertices() const;
+
+  private:
+    void setClippingPolygon(const Point* vertices, int32_t numVertices);
+    double clipIntoScratch(const Point* vertices, int32_t numVertices);
+    bool isOutsideClippingBounds(const Point* vertices,
+                                 int32_t numVertices) const;
+    void clipAgainstEdge(const Point& edgeStart,
+                         const Point& edgeEnd,
+                         const eastl::vector<Point>& subjectVertices,
+                         eastl::vector<Point>& clippedVertices) const;
+
+    eastl::vector<Point> clipVertices;
+    Point clipMinPt;
+    Point clipMaxPt;
+    double orientation;
+
+    eastl::vector<Point> inputBuffer;
+    eastl::vector<Point> outputBuffer;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
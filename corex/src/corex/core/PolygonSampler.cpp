@@ -0,0 +1,106 @@
+#include <cassert>
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+
+#include <corex/core/AliasTable.hpp>
+#include <corex/core/math_functions.hpp>
+#include <corex/core/PolygonSampler.hpp>
+#include <corex/core/utils.hpp>
+#include <corex/core/ds/Line.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
+
+namespace corex::core
+{
+  PolygonSampler::PolygonSampler(const NPolygon& polygon)
+    : triangles()
+    , triangleTable()
+    , area(0.0)
+    , edges()
+    , edgeTable()
+  {
+    this->buildTables(polygon);
+  }
+
+  PolygonSampler::PolygonSampler(const PreparedPolygon& polygon)
+    : PolygonSampler(polygon.polygon) {}
+
+  Point PolygonSampler::sample() const
+  {
+    if (!this->edges.empty()) {
+      const Line& edge = this->edges[this->edgeTable.sample()];
+      const float t = getRandomRealUniformly(0.f, 1.f);
+      return edge.start + ((edge.end - edge.start) * t);
+    }
+
+    return getRandomPointInTriangle(
+      this->triangles[this->triangleTable.sample()]);
+  }
+
+  void PolygonSampler::sample(int32_t numSamples,
+                              eastl::vector<Point>& sampledPoints) const
+  {
+    sampledPoints.resize(numSamples);
+    this->sample(numSamples, sampledPoints.data());
+  }
+
+  void PolygonSampler::sample(int32_t numSamples, Point* sampledPoints) const
+  {
+    for (int32_t i = 0; i < numSamples; i++) {
+      sampledPoints[i] = this->sample();
+    }
+  }
+
+  const eastl::vector<Polygon<3>>& PolygonSampler::getTriangles() const
+  {
+    return this->triangles;
+  }
+
+  double PolygonSampler::getArea() const
+  {
+    return this->area;
+  }
+
+  void PolygonSampler::buildTables(const NPolygon& polygon)
+  {
+    const auto& vertices = polygon.vertices;
+    assert(!vertices.empty());
+
+    earClipTriangulate(polygon, this->triangles);
+
+    eastl::vector<float> triangleAreas(this->triangles.size());
+    for (int32_t i = 0; i < this->triangles.size(); i++) {
+      triangleAreas[i] = static_cast<float>(
+        getPolygonArea(this->triangles[i]));
+      this->area += triangleAreas[i];
+    }
+
+    if (this->area > 0.0) {
+      this->triangleTable.build(triangleAreas);
+      return;
+    }
+
+    // The polygon has no area, so the triangles would all have a weight of
+    // zero. Fall back to picking an edge by its length instead.
+    const int32_t numVertices = vertices.size();
+    eastl::vector<float> edgeLengths(numVertices);
+    double perimeter = 0.0;
+    this->edges.resize(numVertices);
+    for (int32_t i = 0; i < numVertices; i++) {
+      this->edges[i] = Line{ vertices[i], vertices[(i + 1) % numVertices] };
+      edgeLengths[i] = distance2D(this->edges[i].start, this->edges[i].end);
+      perimeter += edgeLengths[i];
+    }
+
+    if (perimeter <= 0.0) {
+      // Every vertex is at the same spot.
+      this->edges.resize(1);
+      edgeLengths.assign(1, 1.f);
+    }
+
+    this->edgeTable.build(edgeLengths);
+  }
+}
@@ -0,0 +1,57 @@
+#ifndef COREX_CORE_POLYGON_SAMPLER_HPP
+#define COREX_CORE_POLYGON_SAMPLER_HPP
+
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+
+#include <corex/core/AliasTable.hpp>
+#include <corex/core/ds/Line.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
+
+namespace corex::core
+{
+  // Samples points uniformly from the inside of a polygon, which may be
+  // concave. The polygon is triangulated only once. Each sample picks a
+  // triangle with a probability proportional to its area, and then picks a
+  // point uniformly inside that triangle. No samples are ever rejected,
+  // unlike when sampling from the polygon's bounding box.
+  //
+  // Polygons with no area (e.g. a bounding box with no width) can't be
+  // sampled through their triangles. Points are sampled uniformly along the
+  // polygon's edges instead, which is where all of the polygon lies.
+  class PolygonSampler
+  {
+  public:
+    explicit PolygonSampler(const NPolygon& polygon);
+    explicit PolygonSampler(const PreparedPolygon& polygon);
+
+    Point sample() const;
+    void sample(int32_t numSamples, eastl::vector<Point>& sampledPoints) const;
+    void sample(int32_t numSamples, Point* sampledPoints) const;
+
+    const eastl::vector<Polygon<3>>& getTriangles() const;
+    double getArea() const;
+
+  private:
+    void buildTables(const NPolygon& polygon);
+
+    eastl::vector<Polygon<3>> triangles;
+    AliasTable triangleTable;
+    double area;
+
+    // Only used when the polygon has no area.
+    eastl::vector<Line> edges;
+    AliasTable edgeTable;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
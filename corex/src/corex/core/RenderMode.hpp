@@ -0,0 +1,23 @@
+#ifndef COREX_CORE_RENDER_MODE_HPP
+#define COREX_CORE_RENDER_MODE_HPP
+
+namespace corex::core
+{
+  // WINDOWED is the usual interactive mode. OFFSCREEN and NULL_RENDERER are
+  // headless. Both use a hidden window on SDL's offscreen video driver, so
+  // textures and fonts still load. OFFSCREEN draws everything into it, using
+  // whatever OpenGL implementation is available (e.g. Mesa's llvmpipe).
+  // NULL_RENDERER runs all of the CPU-side render work, but only counts the
+  // draw commands instead of submitting them.
+  enum class RenderMode
+  {
+    WINDOWED, OFFSCREEN, NULL_RENDERER
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
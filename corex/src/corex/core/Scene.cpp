@@ -1,17 +1,22 @@
 #include <cstdint>
 
+#include <EASTL/shared_ptr.h>
 #include <entt/entt.hpp>
+#include <SDL_gpu.h>
 
 #include <corex/core/AssetManager.hpp>
 #include <corex/core/Camera.hpp>
 #include <corex/core/Scene.hpp>
 #include <corex/core/ds/LineSegments.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
 #include <corex/core/components/Position.hpp>
 #include <corex/core/components/Renderable.hpp>
 #include <corex/core/components/RenderableType.hpp>
 #include <corex/core/components/RenderCircle.hpp>
+#include <corex/core/components/RenderImage.hpp>
 #include <corex/core/components/RenderLineSegments.hpp>
+#include <corex/core/components/RenderPointCloud.hpp>
 
 namespace corex::core
 {
@@ -53,13 +58,52 @@ namespace corex::core
     Scene::SortingLayer defaultSortingLayer = 1;
 
     this->registry.emplace<Scene::EntitySceneProperty>(
-      entity, defaultLayer, defaultSortingLayer
+      entity,
+      defaultLayer,
+      defaultSortingLayer,
+      static_cast<int32_t>(this->entities.size())
     );
     this->entities.push_back(entity);
 
     return entity;
   }
 
+  void Scene::destroySceneEntity(Scene::Entity entity)
+  {
+    // Move the last entity into the slot of the destroyed one, so that the
+    // entity list doesn't keep growing as entities come and go.
+    const int32_t entityIndex = this->registry
+                                    .get<Scene::EntitySceneProperty>(entity)
+                                    .entityIndex;
+    const Scene::Entity lastEntity = this->entities.back();
+    this->entities[entityIndex] = lastEntity;
+    this->registry.get<Scene::EntitySceneProperty>(lastEntity).entityIndex =
+      entityIndex;
+    this->entities.pop_back();
+
+    this->registry.destroy(entity);
+  }
+
+  void Scene::setEntityVisibility(Scene::Entity entity, bool isVisible)
+  {
+    this->registry.get<Renderable>(entity).isVisible = isVisible;
+  }
+
+  bool Scene::isEntityVisible(Scene::Entity entity)
+  {
+    return this->registry.get<Renderable>(entity).isVisible;
+  }
+
+  void Scene::destroyEntityPool(Scene::EntityPool& pool)
+  {
+    for (Scene::Entity entity : pool.entities) {
+      this->destroySceneEntity(entity);
+    }
+
+    pool.entities.clear();
+    pool.numActiveEntities = 0;
+  }
+
   void Scene::setEntityLayer(Scene::Entity entity, Scene::Layer layer)
   {
     this->registry.patch<Scene::EntitySceneProperty>(
@@ -157,4 +201,39 @@ namespace corex::core
 
     return e;
   }
+
+  Scene::Entity Scene::createImageEntity(float x,
+                                         float y,
+                                         float z,
+                                         float width,
+                                         float height,
+                                         eastl::shared_ptr<GPU_Image> image,
+                                         int8_t sortingLayerID)
+  {
+    Scene::Entity e = this->createSceneEntity();
+    this->setEntityComponent<Position>(e, x, y, z, sortingLayerID);
+    this->setEntityComponent<Renderable>(e, RenderableType::IMAGE);
+    this->setEntityComponent<RenderImage>(e, width, height, image);
+
+    return e;
+  }
+
+  Scene::Entity Scene::createPointCloudEntity(float z,
+                                              const PointHistory* history,
+                                              float radius,
+                                              SDL_Color colour,
+                                              int8_t sortingLayerID)
+  {
+    Scene::Entity e = this->createSceneEntity();
+    this->setEntityComponent<Position>(e, 0.f, 0.f, z, sortingLayerID);
+    this->setEntityComponent<Renderable>(e, RenderableType::POINT_CLOUD);
+    this->setEntityComponent<RenderPointCloud>(e,
+                                               history,
+                                               0,
+                                               0,
+                                               radius,
+                                               colour);
+
+    return e;
+  }
 }
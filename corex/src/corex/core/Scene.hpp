@@ -5,14 +5,17 @@
 #include <utility>
 
 #include <EASTL/array.h>
+#include <EASTL/shared_ptr.h>
 #include <EASTL/vector.h>
 
 #include <entt/entt.hpp>
+#include <SDL_gpu.h>
 
 #include <corex/core/AssetManager.hpp>
 #include <corex/core/Camera.hpp>
 #include <corex/core/SceneStatus.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
 
 namespace corex::core
 {
@@ -30,6 +33,16 @@ namespace corex::core
     {
       Layer layer;
       SortingLayer sortingLayer;
+      int32_t entityIndex; // Index of the entity in Scene::entities.
+    };
+
+    // A group of entities that get hidden and shown again instead of being
+    // destroyed and created again, so that resizing the group doesn't churn
+    // the registry. Only the first numActiveEntities entities are visible.
+    struct EntityPool
+    {
+      eastl::vector<Entity> entities;
+      int32_t numActiveEntities = 0;
     };
 
     Scene(entt::registry& registry,
@@ -61,6 +74,9 @@ namespace corex::core
     SceneStatus status;
 
     Scene::Entity createSceneEntity();
+    void destroySceneEntity(Scene::Entity entity);
+    void setEntityVisibility(Scene::Entity entity, bool isVisible);
+    bool isEntityVisible(Scene::Entity entity);
     void setEntityLayer(Scene::Entity entity, Scene::Layer layer);
     Scene::Layer getEntityLayer(Scene::Entity entity);
     void setEntitySortingLayer(Scene::Entity entity, Scene::SortingLayer layer);
@@ -79,6 +95,32 @@ namespace corex::core
       return this->registry.get<Component>(entity);
     }
 
+    // Shows the first numEntities entities of the pool and hides the rest.
+    // The pool only gets new entities, made by createEntity(), when it has
+    // fewer than numEntities entities. Entities that get shown again keep the
+    // components they had, so callers should update them afterwards.
+    template <typename EntityFactory>
+    void resizeEntityPool(Scene::EntityPool& pool,
+                          int32_t numEntities,
+                          EntityFactory createEntity)
+    {
+      while (static_cast<int32_t>(pool.entities.size()) < numEntities) {
+        pool.entities.push_back(createEntity());
+      }
+
+      for (int32_t i = pool.numActiveEntities; i < numEntities; i++) {
+        this->setEntityVisibility(pool.entities[i], true);
+      }
+
+      for (int32_t i = numEntities; i < pool.numActiveEntities; i++) {
+        this->setEntityVisibility(pool.entities[i], false);
+      }
+
+      pool.numActiveEntities = numEntities;
+    }
+
+    void destroyEntityPool(Scene::EntityPool& pool);
+
     void enableLayer(Scene::Layer layer);
     void disableLayer(Scene::Layer layer);
     bool isLayerEnabled(Scene::Layer layer);
@@ -100,6 +142,18 @@ namespace corex::core
                                      bool isFilled,
                                      SDL_Color colour,
                                      int8_t sortingLayerID);
+    Scene::Entity createImageEntity(float x,
+                                    float y,
+                                    float z,
+                                    float width,
+                                    float height,
+                                    eastl::shared_ptr<GPU_Image> image,
+                                    int8_t sortingLayerID);
+    Scene::Entity createPointCloudEntity(float z,
+                                         const PointHistory* history,
+                                         float radius,
+                                         SDL_Color colour,
+                                         int8_t sortingLayerID);
 
   private:
     float ppmRatio;
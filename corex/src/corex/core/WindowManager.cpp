@@ -6,6 +6,7 @@
 #include <SDL2/SDL.h>
 #include <SDL_gpu.h>
 
+#include <corex/core/RenderMode.hpp>
 #include <corex/core/ReturnState.hpp>
 #include <corex/core/sdl_deleters.hpp>
 #include <corex/core/Settings.hpp>
@@ -13,12 +14,14 @@
 #include <corex/core/utils.hpp>
 #include <corex/core/WindowManager.hpp>
 #include <corex/core/events/sys_events.hpp>
+#include <corex/core/renderer/GPUContextLock.hpp>
 
 namespace corex::core
 {
   WindowManager::WindowManager(const eastl::string& windowTitle,
                                entt::dispatcher& eventDispatcher,
-                               Settings& settings)
+                               Settings& settings,
+                               RenderMode renderMode)
   {
     GPU_SetPreInitFlags(GPU_INIT_DISABLE_VSYNC
                         | GPU_INIT_REQUEST_COMPATIBILITY_PROFILE);
@@ -57,6 +60,14 @@ namespace corex::core
       settings.setVariable("window_is_resizeable", true);
     }
 
+    if (renderMode != RenderMode::WINDOWED) {
+      // Headless modes get a hidden window. We prefer SDL's offscreen video
+      // driver so that no display is needed, but still let users pick a
+      // different driver through SDL_VIDEODRIVER.
+      SDL_setenv("SDL_VIDEODRIVER", "offscreen", 0);
+      windowFlags |= SDL_WINDOW_HIDDEN;
+    }
+
     renderTarget = GPU_Init(windowWidth, windowHeight, windowFlags);
 
     SDL_Window* windowPtr = SDL_GetWindowFromID(renderTarget->context
@@ -105,9 +116,10 @@ namespace corex::core
   void WindowManager::handleWindowEvents(const WindowEvent& e)
   {
     switch (e.event.window.event) {
-      case SDL_WINDOWEVENT_RESIZED:
+      case SDL_WINDOWEVENT_RESIZED: {
+        GPUContextLock contextLock;
         GPU_SetWindowResolution(e.event.window.data1, e.event.window.data2);
-        break;
+      } break;
     }
   }
 }
@@ -8,6 +8,7 @@
 #include <SDL2/SDL.h>
 #include <SDL_gpu.h>
 
+#include <corex/core/RenderMode.hpp>
 #include <corex/core/sdl_deleters.hpp>
 #include <corex/core/Settings.hpp>
 #include <corex/core/events/sys_events.hpp>
@@ -19,7 +20,8 @@ namespace corex::core
 	public:
 		WindowManager(const eastl::string& windowTitle,
                   entt::dispatcher& eventDispatcher,
-                  Settings& settings);
+                  Settings& settings,
+                  RenderMode renderMode = RenderMode::WINDOWED);
     ~WindowManager();
 
 		SDL_Window* getWindow();
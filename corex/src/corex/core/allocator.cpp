@@ -1,5 +1,10 @@
+#include <cassert>
+#include <cstddef>
 #include <cstdlib>
 
+#include <corex/core/memory/allocation_tracking.hpp>
+#include <corex/core/memory/memory_functions.hpp>
+
 // Code based from here:
 //   https://web.archive.org/web/20170314154559/
 //           https://wuyingren.github.io/howto/2016/02/11/
@@ -8,12 +13,24 @@
 void* operator new[](size_t size, const char* pName, int flags,
                      unsigned debugFlags, const char* file, int line) 
 {
+#ifdef COREX_TRACK_ALLOCATIONS
+  return corex::core::allocateTracked(size, alignof(max_align_t));
+#else
   return malloc(size);
+#endif
 }  
 
 void* operator new[](size_t size, size_t alignment, size_t alignmentOffset,
                      const char* pName, int flags, unsigned debugFlags,
                      const char* file, int line) 
 {
-  return malloc(size);
+  // EASTL frees these with delete[], which ends up calling free(). That works
+  // since allocateAligned() only ever returns memory that free() can handle.
+  // EASTL only asks for an offset in containers we don't use.
+  assert(alignmentOffset == 0);
+#ifdef COREX_TRACK_ALLOCATIONS
+  return corex::core::allocateTracked(size, alignment);
+#else
+  return corex::core::allocateAligned(size, alignment);
+#endif
 }
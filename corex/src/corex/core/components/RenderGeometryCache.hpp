@@ -0,0 +1,37 @@
+#ifndef COREX_CORE_COMPONENTS_RENDER_GEOMETRY_CACHE_HPP
+#define COREX_CORE_COMPONENTS_RENDER_GEOMETRY_CACHE_HPP
+
+#include <EASTL/vector.h>
+
+#include <corex/core/ds/AABB.hpp>
+
+namespace corex::core
+{
+  // World-space vertices of a RenderRectangle or RenderPolygon, kept by the
+  // RenderGeometryCacher system so that the geometry doesn't have to be
+  // rebuilt every frame.
+  struct RenderGeometryCache
+  {
+    // x and y coordinates of each vertex, interleaved, in the layout SDL_gpu
+    // expects.
+    eastl::vector<float> vertices;
+    AABB bounds;
+
+    // The rectangle the vertices were built from. Only used by rectangles,
+    // since their fields can be modified without going through the registry.
+    float x;
+    float y;
+    float width;
+    float height;
+    float angle;
+
+    bool isDirty;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
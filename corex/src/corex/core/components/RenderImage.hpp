@@ -0,0 +1,25 @@
+#ifndef COREX_CORE_COMPONENTS_RENDER_IMAGE_HPP
+#define COREX_CORE_COMPONENTS_RENDER_IMAGE_HPP
+
+#include <EASTL/shared_ptr.h>
+#include <SDL_gpu.h>
+
+namespace corex::core
+{
+  // A whole image stretched over a width by height area, centered on the
+  // entity's position. Unlike sprites, the image doesn't need to be the same
+  // size as the area it's drawn on.
+  struct RenderImage
+  {
+    float width;
+    float height;
+    eastl::shared_ptr<GPU_Image> image;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
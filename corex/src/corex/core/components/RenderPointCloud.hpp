@@ -0,0 +1,34 @@
+#ifndef COREX_CORE_COMPONENTS_RENDER_POINT_CLOUD_HPP
+#define COREX_CORE_COMPONENTS_RENDER_POINT_CLOUD_HPP
+
+#include <cstdlib>
+
+#include <SDL2/SDL.h>
+
+#include <corex/core/ds/PointHistory.hpp>
+
+namespace corex::core
+{
+  // Filled circles of the same size and colour, one for each point in a
+  // frame of a history. Points are read straight from the history when the
+  // frame gets recorded, so showing another frame only takes changing
+  // frameIndex. The history must outlive the component.
+  //
+  // Points are in world coordinates. The entity's position is only used for
+  // its sorting layer and z.
+  struct RenderPointCloud
+  {
+    const PointHistory* history;
+    int32_t frameIndex;
+    int32_t firstPointIndex; // Points before this one are not drawn.
+    float radius;
+    SDL_Color colour;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -8,6 +8,10 @@ namespace corex::core
   struct Renderable
   {
     RenderableType type;
+
+    // Hidden entities keep their components but don't get drawn, which lets
+    // scenes reuse them instead of destroying and creating them again.
+    bool isVisible = true;
   };
 }
 
@@ -6,7 +6,7 @@ namespace corex::core
   enum class RenderableType
   {
     TEXT, SPRITE, PRIMITIVE_RECTANGLE, PRIMITIVE_POLYGON, LINE_SEGMENTS,
-    PRIMITIVE_CIRCLE
+    PRIMITIVE_CIRCLE, IMAGE, POINT_CLOUD
   };
 }
 
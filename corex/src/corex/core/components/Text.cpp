@@ -1,54 +1,177 @@
+#include <algorithm>
+#include <cstdint>
+
+#include <EASTL/shared_ptr.h>
 #include <EASTL/string.h>
-#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
 #include <SDL2/SDL.h>
 #include <SDL_gpu.h>
 
 #include <corex/core/asset_types/Font.hpp>
 #include <corex/core/components/Text.hpp>
-#include <corex/core/sdl_deleters.hpp>
+#include <corex/core/memory/ArenaAllocator.hpp>
+#include <corex/core/renderer/GlyphAtlas.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
 
 namespace corex::core
 {
+  // Functions and that should only be accessible here.
+  constexpr int32_t _numValuesPerVertex = 8; // x, y, s, t, r, g, b, a
+
+  // Indexes are unsigned shorts, and each glyph takes four vertices.
+  constexpr int32_t _maxNumGlyphQuads = 65535 / 4;
+  /////////////////////////////////////////////////
+
   Text::Text(const eastl::string&& text, Font font, SDL_Color colour)
-    : renderableText(nullptr)
-    , text(text)
+    : text(text)
     , font(font)
     , colour(colour)
+    , atlas(getGlyphAtlas(font))
+    , glyphQuads()
+    , indexes()
+    , width(0.f)
+    , height(0.f)
   {
-    this->generateTextTexture();
-  }
-
-  GPU_Image* Text::getRenderableText() const
-  {
-    return this->renderableText.get();
+    this->layoutGlyphs();
   }
 
   void Text::setText(const eastl::string&& text)
   {
+    if (this->text == text) {
+      return;
+    }
+
     this->text = text;
-    this->generateTextTexture();
+    this->layoutGlyphs();
   }
 
   void Text::setFont(const Font font)
   {
     this->font = font;
-    this->generateTextTexture();
+    this->atlas = getGlyphAtlas(font);
+    this->layoutGlyphs();
   }
 
   void Text::setColour(const SDL_Color colour)
   {
+    // The colour is only applied when recording, so there's nothing to redo.
     this->colour = colour;
-    this->generateTextTexture();
   }
 
-  void Text::generateTextTexture()
+  void Text::record(RenderCommandList& commandList, float x, float y) const
+  {
+    GPU_Image* atlasImage = this->atlas->getImage();
+    if (this->glyphQuads.empty() || atlasImage == nullptr) {
+      return;
+    }
+
+    // The atlas might have grown since the glyphs were laid out, so texture
+    // coordinates are only worked out now.
+    const float invAtlasWidth = 1.f / this->atlas->getWidth();
+    const float invAtlasHeight = 1.f / this->atlas->getHeight();
+    const float r = this->colour.r / 255.f;
+    const float g = this->colour.g / 255.f;
+    const float b = this->colour.b / 255.f;
+    const float a = this->colour.a / 255.f;
+    const float originX = x - (this->width / 2.f);
+    const float originY = y - (this->height / 2.f);
+
+    // The list copies the vertices, so they only need to last for the frame.
+    const int32_t numVertices = this->glyphQuads.size() * 4;
+    eastl::vector<float, ArenaAllocator> vertexValues(
+      numVertices * _numValuesPerVertex,
+      ArenaAllocator{ "Text Vertices" });
+
+    float* vertexValue = vertexValues.data();
+    for (const GlyphQuad& quad : this->glyphQuads) {
+      const float left = originX + quad.dstRect.x;
+      const float top = originY + quad.dstRect.y;
+      const float right = left + quad.dstRect.w;
+      const float bottom = top + quad.dstRect.h;
+      const float s0 = quad.srcRect.x * invAtlasWidth;
+      const float t0 = quad.srcRect.y * invAtlasHeight;
+      const float s1 = (quad.srcRect.x + quad.srcRect.w) * invAtlasWidth;
+      const float t1 = (quad.srcRect.y + quad.srcRect.h) * invAtlasHeight;
+
+      const float corners[4][4] = {
+        { left, top, s0, t0 },
+        { right, top, s1, t0 },
+        { right, bottom, s1, t1 },
+        { left, bottom, s0, t1 }
+      };
+      for (const auto& corner : corners) {
+        vertexValue[0] = corner[0];
+        vertexValue[1] = corner[1];
+        vertexValue[2] = corner[2];
+        vertexValue[3] = corner[3];
+        vertexValue[4] = r;
+        vertexValue[5] = g;
+        vertexValue[6] = b;
+        vertexValue[7] = a;
+        vertexValue += _numValuesPerVertex;
+      }
+    }
+
+    commandList.addTexturedTriangles(atlasImage,
+                                     vertexValues.data(),
+                                     numVertices,
+                                     this->indexes.data(),
+                                     this->indexes.size());
+  }
+
+  GPU_Image* Text::getAtlasImage() const
+  {
+    return this->atlas->getImage();
+  }
+
+  float Text::getWidth() const
+  {
+    return this->width;
+  }
+
+  float Text::getHeight() const
   {
-    SDL_Surface* textSurface = TTF_RenderText_Blended(this->font.get(),
-                                                      this->text.c_str(),
-                                                      this->colour);
-    this->renderableText = eastl::unique_ptr<GPU_Image, SDLGPUImageDeleter>(
-      GPU_CopyImageFromSurface(textSurface));
+    return this->height;
+  }
+
+  void Text::layoutGlyphs()
+  {
+    this->glyphQuads.clear();
+    this->indexes.clear();
+
+    // Same as TTF_RenderText_Blended(), each byte is a Latin-1 character.
+    float penX = 0.f;
+    float textWidth = 0.f;
+    unsigned char prevCharacter = '\0';
+    for (char c : this->text) {
+      const auto character = static_cast<unsigned char>(c);
+      if (prevCharacter != '\0') {
+        penX += this->atlas->getKerning(prevCharacter, character);
+      }
+
+      const GlyphAtlas::Glyph& glyph = this->atlas->getGlyph(character);
+      if (glyph.hasImage && this->glyphQuads.size() < _maxNumGlyphQuads) {
+        const GPU_Rect dstRect{ penX, 0.f, glyph.srcRect.w, glyph.srcRect.h };
+        this->glyphQuads.push_back(GlyphQuad{ dstRect, glyph.srcRect });
+        textWidth = std::max(textWidth, penX + glyph.srcRect.w);
+      }
+
+      penX += glyph.advance;
+      textWidth = std::max(textWidth, penX);
+      prevCharacter = character;
+    }
+
+    for (int32_t i = 0; i < this->glyphQuads.size(); i++) {
+      const auto firstIndex = static_cast<unsigned short>(i * 4);
+      this->indexes.push_back(firstIndex);
+      this->indexes.push_back(firstIndex + 1);
+      this->indexes.push_back(firstIndex + 2);
+      this->indexes.push_back(firstIndex);
+      this->indexes.push_back(firstIndex + 2);
+      this->indexes.push_back(firstIndex + 3);
+    }
 
-    SDL_FreeSurface(textSurface);
+    this->width = textWidth;
+    this->height = static_cast<float>(this->atlas->getLineHeight());
   }
 }
@@ -1,32 +1,56 @@
 #ifndef COREX_CORE_COMPONENTS_TEXT_HPP
 #define COREX_CORE_COMPONENTS_TEXT_HPP
 
+#include <cstdint>
+
+#include <EASTL/shared_ptr.h>
 #include <EASTL/string.h>
-#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
 #include <SDL2/SDL.h>
 #include <SDL_gpu.h>
 
 #include <corex/core/asset_types/Font.hpp>
-#include <corex/core/sdl_deleters.hpp>
+#include <corex/core/renderer/GlyphAtlas.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
 
 namespace corex::core
 {
+  // Text drawn as quads from the glyph atlas of its font. Changing the text
+  // only lays the glyphs out again, and only glyphs that haven't been used
+  // with the font before get uploaded. Texts with the same font share a
+  // texture, so they get drawn together.
   class Text
   {
   public:
     Text(const eastl::string&& text, Font font, SDL_Color colour);
-    GPU_Image* getRenderableText() const;
     void setText(const eastl::string&& text);
     void setFont(const Font font);
     void setColour(const SDL_Color colour);
 
+    // Records the glyph quads, with the text centered on the given position.
+    void record(RenderCommandList& commandList, float x, float y) const;
+
+    GPU_Image* getAtlasImage() const;
+    float getWidth() const;
+    float getHeight() const;
+
   private:
-    eastl::unique_ptr<GPU_Image, SDLGPUImageDeleter> renderableText;
+    struct GlyphQuad
+    {
+      GPU_Rect dstRect; // Relative to the top left corner of the text.
+      GPU_Rect srcRect; // In atlas pixels.
+    };
+
     eastl::string text;
     Font font;
     SDL_Color colour;
+    eastl::shared_ptr<GlyphAtlas> atlas;
+    eastl::vector<GlyphQuad> glyphQuads;
+    eastl::vector<unsigned short> indexes;
+    float width;
+    float height;
 
-    void generateTextTexture();
+    void layoutGlyphs();
   };
 }
 
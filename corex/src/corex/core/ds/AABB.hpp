@@ -0,0 +1,19 @@
+#ifndef COREX_CORE_DS_AABB_HPP
+#define COREX_CORE_DS_AABB_HPP
+
+#include <type_traits>
+
+#include <corex/core/ds/Point.hpp>
+
+namespace corex::core
+{
+  struct AABB
+  {
+    Point minPt;
+    Point maxPt;
+  };
+
+  static_assert(std::is_trivially_copyable_v<AABB>);
+}
+
+#endif
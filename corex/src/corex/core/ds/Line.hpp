@@ -1,6 +1,8 @@
 #ifndef COREX_CORE_DS_LINE_HPP
 #define COREX_CORE_DS_LINE_HPP
 
+#include <type_traits>
+
 #include <corex/core/ds/Point.hpp>
 
 namespace corex::core
@@ -10,6 +12,8 @@ namespace corex::core
     Point start;
     Point end;
   };
+
+  static_assert(std::is_trivially_copyable_v<Line>);
 }
 
 #endif
@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COREX_POINT_HISTORY_USE_SSE2
+#endif
+
+#include <EASTL/vector.h>
+
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  static_assert(sizeof(Point) == sizeof(float) * 2,
+                "Interpolation assumes that points are packed x, y pairs.");
+
+  // Interpolates the values one at a time, for whatever the SIMD path didn't
+  // get to.
+  void _lerpValuesScalar(const float* fromValues,
+                         const float* toValues,
+                         int32_t numValues,
+                         float t,
+                         float* outValues)
+  {
+    for (int32_t i = 0; i < numValues; i++) {
+      outValues[i] = fromValues[i] + ((toValues[i] - fromValues[i]) * t);
+    }
+  }
+
+#ifdef COREX_POINT_HISTORY_USE_SSE2
+  // Interpolates eight values, or four points, per iteration. Returns the
+  // number of values that got interpolated.
+  int32_t _lerpValuesSSE2(const float* fromValues,
+                          const float* toValues,
+                          int32_t numValues,
+                          float t,
+                          float* outValues)
+  {
+    const __m128 ts = _mm_set1_ps(t);
+    const int32_t numBatchedValues = numValues - (numValues % 8);
+    for (int32_t i = 0; i < numBatchedValues; i += 8) {
+      const __m128 from0 = _mm_loadu_ps(fromValues + i);
+      const __m128 from1 = _mm_loadu_ps(fromValues + i + 4);
+      const __m128 to0 = _mm_loadu_ps(toValues + i);
+      const __m128 to1 = _mm_loadu_ps(toValues + i + 4);
+      _mm_storeu_ps(outValues + i,
+                    _mm_add_ps(from0, _mm_mul_ps(_mm_sub_ps(to0, from0), ts)));
+      _mm_storeu_ps(outValues + i + 4,
+                    _mm_add_ps(from1, _mm_mul_ps(_mm_sub_ps(to1, from1), ts)));
+    }
+
+    return numBatchedValues;
+  }
+#endif
+
+  // Tiles are 64 by 64 points, or 32 KiB, so that both the rows being read
+  // and the rows being written stay in cache.
+  constexpr int32_t _transposeTileSize = 64;
+  constexpr int32_t _maxNumTransposeWorkers = 8;
+
+  // Histories smaller than this are not worth starting threads for.
+  constexpr size_t _minNumPointsPerTransposeWorker = 1 << 18;
+
+  // Transposes the tracks of points firstPoint to lastPoint - 1.
+  void _transposePointBlock(const Point* srcPoints,
+                            int32_t numFrames,
+                            int32_t numPoints,
+                            int32_t firstPoint,
+                            int32_t lastPoint,
+                            Point* dstPoints)
+  {
+    for (int32_t p0 = firstPoint; p0 < lastPoint; p0 += _transposeTileSize) {
+      const int32_t pEnd = std::min(p0 + _transposeTileSize, lastPoint);
+      for (int32_t f0 = 0; f0 < numFrames; f0 += _transposeTileSize) {
+        const int32_t fEnd = std::min(f0 + _transposeTileSize, numFrames);
+        for (int32_t f = f0; f < fEnd; f++) {
+          const Point* srcFrame = srcPoints
+                                  + (static_cast<size_t>(f) * numPoints);
+          for (int32_t p = p0; p < pEnd; p++) {
+            dstPoints[(static_cast<size_t>(p) * numFrames) + f] = srcFrame[p];
+          }
+        }
+      }
+    }
+  }
+  /////////////////////////////////////////////////
+
+  PointHistory::PointHistory()
+    : points()
+    , numPoints(0) {}
+
+  PointHistory::PointHistory(int32_t numPoints, int32_t numReservedFrames)
+    : points()
+    , numPoints(std::max(numPoints, 0))
+  {
+    this->points.reserve(static_cast<size_t>(this->numPoints)
+                         * std::max(numReservedFrames, 0));
+  }
+
+  void PointHistory::addFrame(const Point* points)
+  {
+    this->points.insert(this->points.end(), points, points + this->numPoints);
+  }
+
+  void PointHistory::clear()
+  {
+    this->points.clear();
+  }
+
+  void PointHistory::interpolate(float framePosition, Point* outPoints) const
+  {
+    const int32_t numFrames = this->getNumFrames();
+    if (numFrames == 0) {
+      return;
+    }
+
+    // Written so that a NaN position ends up at the first frame.
+    const float lastFrame = static_cast<float>(numFrames - 1);
+    framePosition = (framePosition > 0.f) ? framePosition : 0.f;
+    framePosition = std::min(framePosition, lastFrame);
+
+    const int32_t fromFrame = static_cast<int32_t>(framePosition);
+    const float t = framePosition - fromFrame;
+    if (t == 0.f) {
+      std::memcpy(outPoints,
+                  this->getFrame(fromFrame),
+                  sizeof(Point) * this->numPoints);
+      return;
+    }
+
+    const auto* fromValues = reinterpret_cast<const float*>(
+      this->getFrame(fromFrame));
+    const auto* toValues = reinterpret_cast<const float*>(
+      this->getFrame(fromFrame + 1));
+    auto* outValues = reinterpret_cast<float*>(outPoints);
+    const int32_t numValues = this->numPoints * 2;
+
+    int32_t numLerpedValues = 0;
+#ifdef COREX_POINT_HISTORY_USE_SSE2
+    numLerpedValues = _lerpValuesSSE2(fromValues,
+                                      toValues,
+                                      numValues,
+                                      t,
+                                      outValues);
+#endif
+
+    _lerpValuesScalar(fromValues + numLerpedValues,
+                      toValues + numLerpedValues,
+                      numValues - numLerpedValues,
+                      t,
+                      outValues + numLerpedValues);
+  }
+
+  Point* PointHistory::getFrame(int32_t frameIndex)
+  {
+    assert(frameIndex >= 0 && frameIndex < this->getNumFrames());
+    return this->points.data()
+           + (static_cast<size_t>(frameIndex) * this->numPoints);
+  }
+
+  const Point* PointHistory::getFrame(int32_t frameIndex) const
+  {
+    assert(frameIndex >= 0 && frameIndex < this->getNumFrames());
+    return this->points.data()
+           + (static_cast<size_t>(frameIndex) * this->numPoints);
+  }
+
+  PointHistory PointHistory::transpose() const
+  {
+    const int32_t numFrames = this->getNumFrames();
+    PointHistory transposedHistory{ numFrames };
+    transposedHistory.points.resize(this->points.size());
+    if (this->points.empty()) {
+      return transposedHistory;
+    }
+
+    // Each worker gets a block of whole tiles of points.
+    const int32_t numHardwareThreads = std::thread::hardware_concurrency();
+    const int32_t maxNumWorkers = static_cast<int32_t>(
+      this->points.size() / _minNumPointsPerTransposeWorker);
+    const int32_t numWorkers = std::clamp(
+      std::min(numHardwareThreads, maxNumWorkers),
+      1,
+      _maxNumTransposeWorkers);
+    const int32_t numTiles = (this->numPoints + _transposeTileSize - 1)
+                             / _transposeTileSize;
+    const int32_t numPointsPerWorker = ((numTiles + numWorkers - 1)
+                                        / numWorkers)
+                                       * _transposeTileSize;
+
+    // The calling thread takes the first block.
+    eastl::vector<std::thread> workers;
+    for (int32_t i = 1; i < numWorkers; i++) {
+      const int32_t firstPoint = i * numPointsPerWorker;
+      if (firstPoint >= this->numPoints) {
+        break;
+      }
+
+      workers.push_back(std::thread(
+        _transposePointBlock,
+        this->points.data(),
+        numFrames,
+        this->numPoints,
+        firstPoint,
+        std::min(firstPoint + numPointsPerWorker, this->numPoints),
+        transposedHistory.points.data()));
+    }
+
+    _transposePointBlock(this->points.data(),
+                         numFrames,
+                         this->numPoints,
+                         0,
+                         std::min(numPointsPerWorker, this->numPoints),
+                         transposedHistory.points.data());
+
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+
+    return transposedHistory;
+  }
+
+  const Point& PointHistory::getPoint(int32_t frameIndex,
+                                      int32_t pointIndex) const
+  {
+    assert(pointIndex >= 0 && pointIndex < this->numPoints);
+    return this->getFrame(frameIndex)[pointIndex];
+  }
+
+  int32_t PointHistory::getNumFrames() const
+  {
+    // Worked out from the number of points, so that a moved-from history
+    // stays consistent.
+    if (this->numPoints == 0) {
+      return 0;
+    }
+
+    return static_cast<int32_t>(this->points.size() / this->numPoints);
+  }
+
+  int32_t PointHistory::getNumPoints() const
+  {
+    return this->numPoints;
+  }
+
+  bool PointHistory::empty() const
+  {
+    return this->points.empty();
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef COREX_CORE_DS_POINT_HISTORY_HPP
+#define COREX_CORE_DS_POINT_HISTORY_HPP
+
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+
+#include <corex/core/ds/Point.hpp>
+
+namespace corex::core
+{
+  // The positions of a fixed number of points over a number of frames, kept
+  // in a single buffer with the frames one after the other. A frame is a
+  // contiguous array of points, so it can be referenced, or handed to
+  // anything that takes an array of points, without being copied.
+  class PointHistory
+  {
+  public:
+    PointHistory();
+    explicit PointHistory(int32_t numPoints, int32_t numReservedFrames = 0);
+
+    // Copies getNumPoints() points into a new frame. Frames are only
+    // reallocated when more frames get added than were reserved.
+    void addFrame(const Point* points);
+    void clear();
+
+    // Writes getNumPoints() points into outPoints, linearly interpolated
+    // between the frames around framePosition. The position is clamped to
+    // the first and last frames. Done with SSE2 when it's available, which
+    // works on two points per register since points are packed x, y pairs.
+    void interpolate(float framePosition, Point* outPoints) const;
+
+    Point* getFrame(int32_t frameIndex);
+    const Point* getFrame(int32_t frameIndex) const;
+
+    // Returns a copy of the history with its frames and points swapped, so
+    // that frame i of the copy is the track of point i through every frame.
+    // The copy is built in cache-sized tiles, with blocks of points spread
+    // over a few threads when the history is large.
+    PointHistory transpose() const;
+
+    const Point& getPoint(int32_t frameIndex, int32_t pointIndex) const;
+    int32_t getNumFrames() const;
+    int32_t getNumPoints() const;
+    bool empty() const;
+
+  private:
+    eastl::vector<Point> points;
+    int32_t numPoints;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
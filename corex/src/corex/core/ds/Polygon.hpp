@@ -2,6 +2,7 @@
 #define COREX_CORE_DS_POLYGON_HPP
 
 #include <cstdlib>
+#include <type_traits>
 
 #include <EASTL/array.h>
 
@@ -14,6 +15,10 @@ namespace corex::core
   {
     eastl::array<Point, numVertices> vertices;
   };
+
+  static_assert(std::is_trivially_copyable_v<Polygon<3>>);
+  static_assert(std::is_trivially_copyable_v<Polygon<4>>);
+  static_assert(sizeof(Polygon<4>) == sizeof(Point) * 4);
 }
 
 #endif
@@ -0,0 +1,38 @@
+#ifndef COREX_CORE_DS_PREPARED_POLYGON_HPP
+#define COREX_CORE_DS_PREPARED_POLYGON_HPP
+
+#include <EASTL/vector.h>
+
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Vec2.hpp>
+
+namespace corex::core
+{
+  struct PreparedPolygon
+  {
+    // An NPolygon with the properties we keep on recomputing cached. This is
+    // meant for polygons that do not change but get queried a lot (e.g. the
+    // bounding area of a search). Create one with preparePolygon() in
+    // math_functions.hpp. If the polygon's vertices are modified, the polygon
+    // must be prepared again.
+    NPolygon polygon;
+
+    // Counterclockwise here means counterclockwise when the origin is in the
+    // center, just like in the rest of math_functions.
+    bool isCounterclockwise;
+    bool isConvex;
+    double area;
+    Point centroid;
+    AABB bounds;
+
+    // edgeNormals[i] is the outward unit normal of the edge from vertex i to
+    // vertex i + 1.
+    eastl::vector<Vec2> edgeNormals;
+    eastl::vector<float> interiorAngles;
+    eastl::vector<bool> isReflex;
+  };
+}
+
+#endif
@@ -0,0 +1,574 @@
+#ifndef COREX_CORE_DS_QUAD_TREE_HPP
+#define COREX_CORE_DS_QUAD_TREE_HPP
+
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/array.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+
+#include <corex/core/ReturnState.hpp>
+#include <corex/core/ReturnValue.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+
+namespace corex::core
+{
+  // A region quadtree for points and rectangles (as AABBs). Unlike Tree, all
+  // nodes are stored contiguously in a pool and refer to their children by
+  // index, so building and querying the tree does not scatter nodes all over
+  // the heap. The four children of a node are always stored next to each
+  // other.
+  //
+  // An element whose bounds straddle several leaves is stored in all of them.
+  // Queries make sure an element is only reported once.
+  //
+  // NOTE: Queries are not thread-safe, even though they are const, since they
+  //       use a scratch buffer to deduplicate results.
+  template <class T>
+  class QuadTree
+  {
+  public:
+    explicit QuadTree(const AABB& bounds,
+                      int32_t maxElementsPerNode = 8,
+                      int32_t maxDepth = 8)
+      : bounds(bounds)
+      , maxElementsPerNode(maxElementsPerNode)
+      , maxDepth(maxDepth)
+      , nodes()
+      , elements()
+      , freeElementIndexes()
+      , elementNodes()
+      , freeElementNodeIndex(-1)
+      , numElements(0)
+      , queryStamps()
+      , currQueryStamp(0)
+      , nodeStack()
+      , insertionStack()
+    {
+      this->clear();
+    }
+
+    void clear()
+    {
+      this->nodes.clear();
+      this->elements.clear();
+      this->freeElementIndexes.clear();
+      this->elementNodes.clear();
+      this->freeElementNodeIndex = -1;
+      this->numElements = 0;
+      this->queryStamps.clear();
+
+      this->nodes.push_back(Node{ this->bounds, -1, -1, 0, 0 });
+    }
+
+    // Rebuilds the tree from scratch with the given items. Any elements
+    // previously in the tree are removed.
+    void build(const eastl::vector<T>& items,
+               const eastl::vector<AABB>& itemBounds)
+    {
+      assert(items.size() == itemBounds.size());
+
+      this->clear();
+      this->elements.reserve(items.size());
+      this->elementNodes.reserve(items.size());
+      for (int32_t i = 0; i < items.size(); i++) {
+        this->insert(items[i], itemBounds[i]);
+      }
+    }
+
+    void build(const eastl::vector<T>& items,
+               const eastl::vector<Point>& itemPositions)
+    {
+      assert(items.size() == itemPositions.size());
+
+      this->clear();
+      this->elements.reserve(items.size());
+      this->elementNodes.reserve(items.size());
+      for (int32_t i = 0; i < items.size(); i++) {
+        this->insert(items[i], itemPositions[i]);
+      }
+    }
+
+    // Returns the ID of the inserted element, which can be passed to remove().
+    // Elements outside the bounds of the tree are still inserted. They just
+    // end up in the leaves closest to them.
+    int32_t insert(const T& item, const AABB& itemBounds)
+    {
+      assert(itemBounds.minPt.x <= itemBounds.maxPt.x
+             && itemBounds.minPt.y <= itemBounds.maxPt.y);
+
+      int32_t elementIndex = -1;
+      if (this->freeElementIndexes.empty()) {
+        elementIndex = this->elements.size();
+        this->elements.push_back(Element{ item, itemBounds, true });
+        this->queryStamps.push_back(0);
+      } else {
+        elementIndex = this->freeElementIndexes.back();
+        this->freeElementIndexes.pop_back();
+        this->elements[elementIndex] = Element{ item, itemBounds, true };
+      }
+
+      this->insertIntoNode(0, elementIndex);
+      this->numElements++;
+
+      return elementIndex;
+    }
+
+    int32_t insert(const T& item, const Point& itemPosition)
+    {
+      return this->insert(item, AABB{ itemPosition, itemPosition });
+    }
+
+    bool remove(int32_t elementID)
+    {
+      if (elementID < 0
+          || elementID >= this->elements.size()
+          || !this->elements[elementID].isAlive) {
+        return false;
+      }
+
+      const AABB elementBounds = this->clampToTreeBounds(
+        this->elements[elementID].bounds);
+      this->nodeStack.clear();
+      this->nodeStack.push_back(0);
+      while (!this->nodeStack.empty()) {
+        int32_t nodeIndex = this->nodeStack.back();
+        this->nodeStack.pop_back();
+
+        Node& node = this->nodes[nodeIndex];
+        if (node.firstChildIndex != -1) {
+          this->pushOverlappingChildren(node, elementBounds);
+          continue;
+        }
+
+        // Unlink the element from the leaf.
+        int32_t prevIndex = -1;
+        int32_t currIndex = node.firstElementNodeIndex;
+        while (currIndex != -1) {
+          ElementNode& elementNode = this->elementNodes[currIndex];
+          int32_t nextIndex = elementNode.nextIndex;
+          if (elementNode.elementIndex == elementID) {
+            if (prevIndex == -1) {
+              node.firstElementNodeIndex = nextIndex;
+            } else {
+              this->elementNodes[prevIndex].nextIndex = nextIndex;
+            }
+
+            this->freeElementNode(currIndex);
+            node.numElements--;
+            break;
+          }
+
+          prevIndex = currIndex;
+          currIndex = nextIndex;
+        }
+      }
+
+      this->elements[elementID].isAlive = false;
+      this->freeElementIndexes.push_back(elementID);
+      this->numElements--;
+
+      return true;
+    }
+
+    void queryRange(const AABB& range, eastl::vector<T>& results) const
+    {
+      results.clear();
+
+      this->currQueryStamp++;
+      if (this->currQueryStamp == 0) {
+        // The stamps wrapped around, so old stamps may now look current.
+        eastl::fill(this->queryStamps.begin(), this->queryStamps.end(), 0);
+        this->currQueryStamp = 1;
+      }
+
+      const AABB clampedRange = this->clampToTreeBounds(range);
+      this->nodeStack.clear();
+      this->nodeStack.push_back(0);
+      while (!this->nodeStack.empty()) {
+        int32_t nodeIndex = this->nodeStack.back();
+        this->nodeStack.pop_back();
+
+        const Node& node = this->nodes[nodeIndex];
+        if (node.firstChildIndex != -1) {
+          this->pushOverlappingChildren(node, clampedRange);
+          continue;
+        }
+
+        for (int32_t i = node.firstElementNodeIndex;
+             i != -1;
+             i = this->elementNodes[i].nextIndex) {
+          int32_t elementIndex = this->elementNodes[i].elementIndex;
+          if (this->queryStamps[elementIndex] == this->currQueryStamp) {
+            // Already checked this element in another leaf.
+            continue;
+          }
+          this->queryStamps[elementIndex] = this->currQueryStamp;
+
+          const Element& element = this->elements[elementIndex];
+          if (areAABBsOverlapping(element.bounds, range)) {
+            results.push_back(element.item);
+          }
+        }
+      }
+    }
+
+    // Finds the element closest to the given point. For rectangles, the
+    // distance is measured to the closest point of its bounds. Fails if there
+    // is no element within maxDistance.
+    ReturnValue<T> queryNearest(
+      const Point& point,
+      float maxDistance = std::numeric_limits<float>::max()) const
+    {
+      float bestSqrdDist = (maxDistance < std::numeric_limits<float>::max())
+                           ? maxDistance * maxDistance
+                           : std::numeric_limits<float>::max();
+      int32_t bestElementIndex = -1;
+
+      this->nodeStack.clear();
+      this->nodeStack.push_back(0);
+      while (!this->nodeStack.empty()) {
+        int32_t nodeIndex = this->nodeStack.back();
+        this->nodeStack.pop_back();
+
+        const Node& node = this->nodes[nodeIndex];
+        if (this->sqrdDistToNode(point, node) > bestSqrdDist) {
+          continue;
+        }
+
+        if (node.firstChildIndex != -1) {
+          // Visit the closest child first, so that we can prune the other
+          // children sooner. The stack is LIFO, so the closest child must be
+          // pushed last.
+          eastl::array<int32_t, 4> childIndexes;
+          eastl::array<float, 4> childSqrdDists;
+          for (int32_t i = 0; i < 4; i++) {
+            childIndexes[i] = node.firstChildIndex + i;
+            childSqrdDists[i] = this->sqrdDistToNode(
+              point, this->nodes[childIndexes[i]]);
+          }
+
+          for (int32_t i = 1; i < 4; i++) {
+            for (int32_t j = i;
+                 j > 0 && childSqrdDists[j - 1] < childSqrdDists[j];
+                 j--) {
+              eastl::swap(childSqrdDists[j - 1], childSqrdDists[j]);
+              eastl::swap(childIndexes[j - 1], childIndexes[j]);
+            }
+          }
+
+          for (int32_t i = 0; i < 4; i++) {
+            if (childSqrdDists[i] <= bestSqrdDist) {
+              this->nodeStack.push_back(childIndexes[i]);
+            }
+          }
+
+          continue;
+        }
+
+        for (int32_t i = node.firstElementNodeIndex;
+             i != -1;
+             i = this->elementNodes[i].nextIndex) {
+          int32_t elementIndex = this->elementNodes[i].elementIndex;
+          float sqrdDist = sqrdDistToAABB(point,
+                                          this->elements[elementIndex].bounds);
+          if (sqrdDist <= bestSqrdDist) {
+            bestSqrdDist = sqrdDist;
+            bestElementIndex = elementIndex;
+          }
+        }
+      }
+
+      if (bestElementIndex == -1) {
+        return ReturnValue<T>{
+          T{},
+          ReturnState::RETURN_FAIL
+        };
+      }
+
+      return ReturnValue<T>{
+        this->elements[bestElementIndex].item,
+        ReturnState::RETURN_OK
+      };
+    }
+
+    int32_t size() const
+    {
+      return this->numElements;
+    }
+
+    bool isEmpty() const
+    {
+      return this->numElements == 0;
+    }
+
+    const AABB& getBounds() const
+    {
+      return this->bounds;
+    }
+
+  private:
+    struct Node
+    {
+      AABB bounds;
+
+      // Index of the first of the four children in the node pool, or -1 if
+      // the node is a leaf. Children are ordered top-left, top-right,
+      // bottom-left, and bottom-right.
+      int32_t firstChildIndex;
+
+      // Only leaves hold elements.
+      int32_t firstElementNodeIndex;
+      int32_t numElements;
+      int32_t depth;
+    };
+
+    struct Element
+    {
+      T item;
+      AABB bounds;
+      bool isAlive;
+    };
+
+    // An entry in the singly linked list of elements in a leaf.
+    struct ElementNode
+    {
+      int32_t elementIndex;
+      int32_t nextIndex;
+    };
+
+    static bool areAABBsOverlapping(const AABB& aabb0, const AABB& aabb1)
+    {
+      return aabb0.minPt.x <= aabb1.maxPt.x && aabb0.maxPt.x >= aabb1.minPt.x
+             && aabb0.minPt.y <= aabb1.maxPt.y
+             && aabb0.maxPt.y >= aabb1.minPt.y;
+    }
+
+    static float sqrdDistToAABB(const Point& point, const AABB& aabb)
+    {
+      float dx = 0.f;
+      if (point.x < aabb.minPt.x) {
+        dx = aabb.minPt.x - point.x;
+      } else if (point.x > aabb.maxPt.x) {
+        dx = point.x - aabb.maxPt.x;
+      }
+
+      float dy = 0.f;
+      if (point.y < aabb.minPt.y) {
+        dy = aabb.minPt.y - point.y;
+      } else if (point.y > aabb.maxPt.y) {
+        dy = point.y - aabb.maxPt.y;
+      }
+
+      return (dx * dx) + (dy * dy);
+    }
+
+    float sqrdDistToNode(const Point& point, const Node& node) const
+    {
+      // Elements outside the tree bounds are stored in the leaves at the
+      // border of the tree, so the sides of a node that lie on the border of
+      // the tree must be treated as if they extend out to infinity.
+      constexpr float infinity = std::numeric_limits<float>::infinity();
+      AABB nodeBounds = node.bounds;
+      if (nodeBounds.minPt.x <= this->bounds.minPt.x) {
+        nodeBounds.minPt.x = -infinity;
+      }
+
+      if (nodeBounds.minPt.y <= this->bounds.minPt.y) {
+        nodeBounds.minPt.y = -infinity;
+      }
+
+      if (nodeBounds.maxPt.x >= this->bounds.maxPt.x) {
+        nodeBounds.maxPt.x = infinity;
+      }
+
+      if (nodeBounds.maxPt.y >= this->bounds.maxPt.y) {
+        nodeBounds.maxPt.y = infinity;
+      }
+
+      return sqrdDistToAABB(point, nodeBounds);
+    }
+
+    AABB clampToTreeBounds(const AABB& aabb) const
+    {
+      // Elements outside the tree bounds are stored in the leaves closest to
+      // them, so clamping makes sure we still reach those leaves.
+      auto clampPoint = [this](const Point& p) -> Point {
+        return Point{
+          eastl::max(this->bounds.minPt.x,
+                     eastl::min(p.x, this->bounds.maxPt.x)),
+          eastl::max(this->bounds.minPt.y,
+                     eastl::min(p.y, this->bounds.maxPt.y))
+        };
+      };
+
+      return AABB{ clampPoint(aabb.minPt), clampPoint(aabb.maxPt) };
+    }
+
+    void pushOverlappingChildren(const Node& node, const AABB& aabb) const
+    {
+      for (int32_t i = 0; i < 4; i++) {
+        int32_t childIndex = node.firstChildIndex + i;
+        if (areAABBsOverlapping(this->nodes[childIndex].bounds, aabb)) {
+          this->nodeStack.push_back(childIndex);
+        }
+      }
+    }
+
+    void insertIntoNode(int32_t startingNodeIndex, int32_t elementIndex)
+    {
+      const AABB elementBounds = this->clampToTreeBounds(
+        this->elements[elementIndex].bounds);
+
+      this->insertionStack.clear();
+      this->insertionStack.push_back(startingNodeIndex);
+      while (!this->insertionStack.empty()) {
+        int32_t nodeIndex = this->insertionStack.back();
+        this->insertionStack.pop_back();
+
+        if (this->nodes[nodeIndex].firstChildIndex != -1) {
+          int32_t firstChildIndex = this->nodes[nodeIndex].firstChildIndex;
+          for (int32_t i = 0; i < 4; i++) {
+            if (areAABBsOverlapping(this->nodes[firstChildIndex + i].bounds,
+                                    elementBounds)) {
+              this->insertionStack.push_back(firstChildIndex + i);
+            }
+          }
+
+          continue;
+        }
+
+        this->linkElementToLeaf(nodeIndex, elementIndex);
+        this->splitNodeIfNeeded(nodeIndex);
+      }
+    }
+
+    void linkElementToLeaf(int32_t nodeIndex, int32_t elementIndex)
+    {
+      int32_t elementNodeIndex = this->allocateElementNode();
+      this->elementNodes[elementNodeIndex] = ElementNode{
+        elementIndex,
+        this->nodes[nodeIndex].firstElementNodeIndex
+      };
+      this->nodes[nodeIndex].firstElementNodeIndex = elementNodeIndex;
+      this->nodes[nodeIndex].numElements++;
+    }
+
+    void splitNodeIfNeeded(int32_t nodeIndex)
+    {
+      if (this->nodes[nodeIndex].numElements <= this->maxElementsPerNode
+          || this->nodes[nodeIndex].depth >= this->maxDepth) {
+        return;
+      }
+
+      const AABB nodeBounds = this->nodes[nodeIndex].bounds;
+      const int32_t childDepth = this->nodes[nodeIndex].depth + 1;
+      const Point midPt = (nodeBounds.minPt + nodeBounds.maxPt) / 2.f;
+
+      // Pushing the children may reallocate the node pool, so we should not
+      // hold any references to nodes here.
+      const int32_t firstChildIndex = this->nodes.size();
+      this->nodes.push_back(Node{
+        AABB{ nodeBounds.minPt, midPt },
+        -1, -1, 0, childDepth
+      });
+      this->nodes.push_back(Node{
+        AABB{
+          Point{ midPt.x, nodeBounds.minPt.y },
+          Point{ nodeBounds.maxPt.x, midPt.y }
+        },
+        -1, -1, 0, childDepth
+      });
+      this->nodes.push_back(Node{
+        AABB{
+          Point{ nodeBounds.minPt.x, midPt.y },
+          Point{ midPt.x, nodeBounds.maxPt.y }
+        },
+        -1, -1, 0, childDepth
+      });
+      this->nodes.push_back(Node{
+        AABB{ midPt, nodeBounds.maxPt },
+        -1, -1, 0, childDepth
+      });
+
+      // Move the elements of the node to its children.
+      int32_t elementNodeIndex = this->nodes[nodeIndex].firstElementNodeIndex;
+      this->nodes[nodeIndex].firstChildIndex = firstChildIndex;
+      this->nodes[nodeIndex].firstElementNodeIndex = -1;
+      this->nodes[nodeIndex].numElements = 0;
+      while (elementNodeIndex != -1) {
+        int32_t nextIndex = this->elementNodes[elementNodeIndex].nextIndex;
+        int32_t elementIndex = this->elementNodes[elementNodeIndex]
+                                 .elementIndex;
+        this->freeElementNode(elementNodeIndex);
+
+        const AABB elementBounds = this->clampToTreeBounds(
+          this->elements[elementIndex].bounds);
+        for (int32_t i = 0; i < 4; i++) {
+          if (areAABBsOverlapping(this->nodes[firstChildIndex + i].bounds,
+                                  elementBounds)) {
+            this->linkElementToLeaf(firstChildIndex + i, elementIndex);
+          }
+        }
+
+        elementNodeIndex = nextIndex;
+      }
+
+      // All the elements may have ended up in the same child.
+      for (int32_t i = 0; i < 4; i++) {
+        this->splitNodeIfNeeded(firstChildIndex + i);
+      }
+    }
+
+    int32_t allocateElementNode()
+    {
+      if (this->freeElementNodeIndex == -1) {
+        this->elementNodes.push_back(ElementNode{ -1, -1 });
+        return this->elementNodes.size() - 1;
+      }
+
+      int32_t elementNodeIndex = this->freeElementNodeIndex;
+      this->freeElementNodeIndex = this->elementNodes[elementNodeIndex]
+                                     .nextIndex;
+
+      return elementNodeIndex;
+    }
+
+    void freeElementNode(int32_t elementNodeIndex)
+    {
+      this->elementNodes[elementNodeIndex] = ElementNode{
+        -1,
+        this->freeElementNodeIndex
+      };
+      this->freeElementNodeIndex = elementNodeIndex;
+    }
+
+    AABB bounds;
+    int32_t maxElementsPerNode;
+    int32_t maxDepth;
+
+    eastl::vector<Node> nodes;
+    eastl::vector<Element> elements;
+    eastl::vector<int32_t> freeElementIndexes;
+    eastl::vector<ElementNode> elementNodes;
+    int32_t freeElementNodeIndex;
+    int32_t numElements;
+
+    // Scratch data for queries.
+    mutable eastl::vector<uint32_t> queryStamps;
+    mutable uint32_t currQueryStamp;
+    mutable eastl::vector<int32_t> nodeStack;
+    eastl::vector<int32_t> insertionStack;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef COREX_CORE_DS_RECTANGLE_HPP
 #define COREX_CORE_DS_RECTANGLE_HPP
 
+#include <type_traits>
+
 namespace corex::core
 {
   struct Rectangle
@@ -12,6 +14,8 @@ namespace corex::core
     float height;
     float angle;
   };
+
+  static_assert(std::is_trivially_copyable_v<Rectangle>);
 }
 
 #endif
@@ -2,29 +2,99 @@
 #define COREX_CORE_DS_VEC2_HPP
 
 #include <cstdlib>
+#include <limits>
+#include <type_traits>
 
 namespace corex::core
 {
+  // Vec2 and its operators are defined in this header so that they can be
+  // inlined in modules outside of corex-core (e.g. gwo-viz). Vec2 must also
+  // stay trivially copyable, so that arrays of it can be memcpy'd around. So,
+  // no user-defined copy constructors, please.
+  //
+  // The arithmetic operators don't round their results. Call setDecPlaces()
+  // on the results if you need them rounded.
   struct Vec2
   {
     float x;
     float y;
 
-    Vec2();
-    Vec2(float x, float y);
-    Vec2(const Vec2& rhs);
+    constexpr Vec2() : x(0.f), y(0.f) {}
+    constexpr Vec2(float x, float y) : x(x), y(y) {}
   };
 
-  Vec2 operator+(const Vec2& p, const Vec2& q);
-  Vec2 operator-(const Vec2& p, const Vec2& q);
-  Vec2 operator*(const Vec2& p, const int32_t& a);
-  Vec2 operator*(const Vec2& p, const float& a);
-  Vec2 operator*(const int32_t& a, const Vec2& p);
-  Vec2 operator*(const float& a, const Vec2& p);
-  Vec2 operator/(const Vec2& p, const int32_t& a);
-  Vec2 operator/(const Vec2& p, const float& a);
-  bool operator==(const Vec2& p, const Vec2& q);
-  bool operator!=(const Vec2& p, const Vec2& q);
+  // Functions that should only be used within this header.
+  constexpr float _vec2FloatAbs(float n)
+  {
+    return (n < 0.f) ? -n : n;
+  }
+
+  constexpr bool _vec2FloatEquals(float x, float y)
+  {
+    // Same as floatEquals() in math_functions.hpp. We can't use that one here
+    // since it isn't constexpr, and math_functions.hpp includes this header.
+    const float maxMagnitude = (_vec2FloatAbs(x) > _vec2FloatAbs(y))
+                               ? _vec2FloatAbs(x)
+                               : _vec2FloatAbs(y);
+    return _vec2FloatAbs(x - y)
+           <= (std::numeric_limits<float>::epsilon()
+               * ((maxMagnitude > 1.f) ? maxMagnitude : 1.f));
+  }
+  /////////////////////////////////////////////////
+
+  constexpr Vec2 operator+(const Vec2& p, const Vec2& q)
+  {
+    return Vec2{ p.x + q.x, p.y + q.y };
+  }
+
+  constexpr Vec2 operator-(const Vec2& p, const Vec2& q)
+  {
+    return Vec2{ p.x - q.x, p.y - q.y };
+  }
+
+  constexpr Vec2 operator*(const Vec2& p, const int32_t& a)
+  {
+    return Vec2{ p.x * a, p.y * a };
+  }
+
+  constexpr Vec2 operator*(const Vec2& p, const float& a)
+  {
+    return Vec2{ p.x * a, p.y * a };
+  }
+
+  constexpr Vec2 operator*(const int32_t& a, const Vec2& p)
+  {
+    return Vec2{ a * p.x, a * p.y };
+  }
+
+  constexpr Vec2 operator*(const float& a, const Vec2& p)
+  {
+    return Vec2{ a * p.x, a * p.y };
+  }
+
+  constexpr Vec2 operator/(const Vec2& p, const int32_t& a)
+  {
+    return Vec2{ p.x / a, p.y / a };
+  }
+
+  constexpr Vec2 operator/(const Vec2& p, const float& a)
+  {
+    return Vec2{ p.x / a, p.y / a };
+  }
+
+  constexpr bool operator==(const Vec2& p, const Vec2& q)
+  {
+    return _vec2FloatEquals(p.x, q.x) && _vec2FloatEquals(p.y, q.y);
+  }
+
+  constexpr bool operator!=(const Vec2& p, const Vec2& q)
+  {
+    return !(p == q);
+  }
+
+  static_assert(std::is_trivially_copyable_v<Vec2>);
+  static_assert(std::is_standard_layout_v<Vec2>);
+  static_assert(sizeof(Vec2) == sizeof(float) * 2);
 }
 
-#endif
\ No newline at end of file
+#endif
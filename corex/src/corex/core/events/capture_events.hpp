@@ -0,0 +1,21 @@
+#ifndef COREX_CORE_EVENTS_CAPTURE_EVENTS_HPP
+#define COREX_CORE_EVENTS_CAPTURE_EVENTS_HPP
+
+#include <EASTL/string.h>
+
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
+
+namespace corex::core
+{
+  // These should be triggered rather than enqueued, so that the capture
+  // starts (or stops) with the frame that is currently being built.
+  struct FrameCaptureStartEvent
+  {
+    eastl::string outputFolder;
+    FrameCaptureFormat format;
+  };
+
+  struct FrameCaptureStopEvent {};
+}
+
+#endif
@@ -1,6 +1,13 @@
 #ifndef COREX_CORE_EVENTS_METRIC_EVENTS_HPP
 #define COREX_CORE_EVENTS_METRIC_EVENTS_HPP
 
+#include <cstdint>
+#include <cstdlib>
+
+#include <EASTL/array.h>
+
+#include <corex/core/memory/allocation_tracking.hpp>
+
 namespace corex::core
 {
   struct FrameDataEvent
@@ -10,6 +17,29 @@ namespace corex::core
     float timeDelta;
     float appTimeDelta;
   };
+
+  struct AllocationTagData
+  {
+    const char* name;
+    AllocationStats totalStats;
+    uint64_t numAllocationsInFrame;
+    uint64_t numBytesAllocatedInFrame;
+  };
+
+  struct AllocationDataEvent
+  {
+    eastl::array<AllocationTagData, maxNumAllocationTags> tags;
+    int32_t numTags;
+  };
+
+  struct RenderDataEvent
+  {
+    int32_t numRenderables;
+    int32_t numVisibleRenderables;
+    int32_t numCulledRenderables;
+    int32_t numRenderCommands;
+    int32_t numMergedRenderCommands;
+  };
 }
 
 #endif
@@ -1,6 +1,7 @@
 #include <EASTL/unique_ptr.h>
 
 #include <corex/core/Application.hpp>
+#include <corex/core/LaunchOptions.hpp>
 
 namespace corex {
   extern eastl::unique_ptr<corex::core::Application> createApplication();
@@ -8,6 +9,8 @@ namespace corex {
 
 int main(int argc, char** argv)
 {
+  corex::core::setLaunchOptions(corex::core::parseLaunchOptions(argc, argv));
+
   auto gameApp = corex::createApplication();
   gameApp->run();
 
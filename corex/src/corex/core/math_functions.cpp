@@ -3,15 +3,19 @@
 #include <cmath>
 #include <cstdlib>
 
-#include <EASTL/set.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/array.h>
 #include <EASTL/vector.h>
 
 #include <corex/core/math_functions.hpp>
+#include <corex/core/PolygonClipper.hpp>
 #include <corex/core/ReturnState.hpp>
 #include <corex/core/ReturnValue.hpp>
 #include <corex/core/utils.hpp>
+#include <corex/core/ds/AABB.hpp>
 #include <corex/core/ds/Line.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
 #include <corex/core/ds/Rectangle.hpp>
 #include <corex/core/ds/Vec2.hpp>
 #include <corex/core/ds/VecN.hpp>
@@ -24,6 +28,26 @@ namespace corex::core {
 
   Line _projectRectToAnAxis(const Rectangle &rect, const Vec2 &axis);
 
+  double _orientedCrossProduct(const Point& a,
+                               const Point& b,
+                               const Point& c,
+                               double orientation);
+
+  bool _isLinkedVertexReflex(const Point& prevVertex,
+                             const Point& currVertex,
+                             const Point& nextVertex,
+                             double orientation);
+
+  bool _isLinkedVertexAnEar(const eastl::vector<Point>& vertices,
+                            int32_t prevIndex,
+                            int32_t currIndex,
+                            int32_t nextIndex,
+                            const eastl::vector<int32_t>& reflexIndexes,
+                            double orientation);
+
+  void _removeReflexVertexIndex(eastl::vector<int32_t>& reflexIndexes,
+                                int32_t vertexIndex);
+
   bool _areTwoRectsCollidingInAnAxis(const Rectangle &rect0,
                                      const Rectangle &rect1,
                                      const Vec2 &axis) {
@@ -80,6 +104,89 @@ namespace corex::core {
                          &possibleRectLine5
                        });
   }
+
+  double _orientedCrossProduct(const Point& a,
+                               const Point& b,
+                               const Point& c,
+                               double orientation)
+  {
+    // Positive if a -> b -> c turns the same way the polygon is oriented.
+    const double abX = static_cast<double>(b.x) - a.x;
+    const double abY = static_cast<double>(b.y) - a.y;
+    const double bcX = static_cast<double>(c.x) - b.x;
+    const double bcY = static_cast<double>(c.y) - b.y;
+    return orientation * ((abX * bcY) - (abY * bcX));
+  }
+
+  bool _isLinkedVertexReflex(const Point& prevVertex,
+                             const Point& currVertex,
+                             const Point& nextVertex,
+                             double orientation)
+  {
+    // Collinear vertices are treated as reflex vertices, just like what
+    // findReflexVertexIndexes() does.
+    return _orientedCrossProduct(prevVertex,
+                                 currVertex,
+                                 nextVertex,
+                                 orientation) <= 0.0;
+  }
+
+  bool _isLinkedVertexAnEar(const eastl::vector<Point>& vertices,
+                            int32_t prevIndex,
+                            int32_t currIndex,
+                            int32_t nextIndex,
+                            const eastl::vector<int32_t>& reflexIndexes,
+                            double orientation)
+  {
+    const Point& a = vertices[prevIndex];
+    const Point& b = vertices[currIndex];
+    const Point& c = vertices[nextIndex];
+    const float minX = eastl::min(a.x, eastl::min(b.x, c.x));
+    const float minY = eastl::min(a.y, eastl::min(b.y, c.y));
+    const float maxX = eastl::max(a.x, eastl::max(b.x, c.x));
+    const float maxY = eastl::max(a.y, eastl::max(b.y, c.y));
+    for (int32_t reflexIndex : reflexIndexes) {
+      const Point& p = vertices[reflexIndex];
+
+      // Cheap rejection test first.
+      if (p.x < minX || p.x > maxX || p.y < minY || p.y > maxY) {
+        continue;
+      }
+
+      if (reflexIndex == prevIndex
+          || reflexIndex == currIndex
+          || reflexIndex == nextIndex) {
+        continue;
+      }
+
+      if (p == a || p == b || p == c) {
+        // Duplicate vertices (e.g. from bridged holes) must not block ears.
+        continue;
+      }
+
+      // Points on the edges of the triangle count as inside.
+      if (_orientedCrossProduct(a, b, p, orientation) >= 0.0
+          && _orientedCrossProduct(b, c, p, orientation) >= 0.0
+          && _orientedCrossProduct(c, a, p, orientation) >= 0.0) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void _removeReflexVertexIndex(eastl::vector<int32_t>& reflexIndexes,
+                                int32_t vertexIndex)
+  {
+    // Order does not matter in the reflex vertex list, so swap and pop.
+    auto iter = eastl::find(reflexIndexes.begin(),
+                            reflexIndexes.end(),
+                            vertexIndex);
+    if (iter != reflexIndexes.end()) {
+      *iter = reflexIndexes.back();
+      reflexIndexes.pop_back();
+    }
+  }
   /////////////////////////////////////////////////
 
   bool floatEquals(float x, float y, float tolerance) {
@@ -291,12 +398,6 @@ namespace corex::core {
     return *longestLine;
   }
 
-  float det3x3(const Vec2& v0, const Vec2& v1, const Vec2& v2)
-  {
-    return ((v1.x * v2.y) + (v0.x * v1.y) + (v0.y * v2.x))
-           - ((v0.y * v1.x) + (v1.y * v2.x) + (v0.x * v2.y));
-  }
-
   float vec2Magnitude(const Vec2& p)
   {
     return distance2D(Vec2{0.f, 0.f}, p);
@@ -334,16 +435,6 @@ namespace corex::core {
     }
   }
 
-  float dotProduct(const Vec2& p, const Vec2& q)
-  {
-    return (p.x * q.x) + (p.y * q.y);
-  }
-
-  float crossProduct(const Vec2& p, const Vec2& q)
-  {
-    return (p.x * q.y) - (p.y * q.x);
-  }
-
   float angleBetweenTwoVectors(const Vec2& p, const Vec2& q)
   {
     return radiansToDegrees(
@@ -382,11 +473,6 @@ namespace corex::core {
     return rotateVec2(p, -90.f);
   }
 
-  Vec2 translateVec2(const Vec2& vec, float deltaX, float deltaY)
-  {
-    return Vec2{vec.x + deltaX, vec.y + deltaY};
-  }
-
   Vec2 minVec2Magnitude(const eastl::vector<Vec2*> vectors)
   {
     // We don't want copies and references can't hold null objects.
@@ -426,11 +512,6 @@ namespace corex::core {
     return vec / vec2Magnitude(vec);
   }
 
-  Vec2 lineToVec(const Line& line)
-  {
-    return Vec2{ line.end.x - line.start.x, line.end.y - line.start.y };
-  }
-
   Vec2 lineDirectionVector(const Line& line)
   {
     return unitVector(lineToVec(line));
@@ -488,26 +569,6 @@ namespace corex::core {
     return w;
   }
 
-  Vec2 pairwiseMult(const Vec2& p, const Vec2& q)
-  {
-    return Vec2{ p.x * q.x, p.y * q.y };
-  }
-
-  Vec2 pairwiseSubt(const Vec2& p, const float& a)
-  {
-    return Vec2{ p.x - a, p.y - a };
-  }
-
-  Vec2 pairwiseSubt(const float& a, const Vec2& p)
-  {
-    return Vec2{ a - p.x, a - p.y };
-  }
-
-  Vec2 vec2Abs(const Vec2& vec)
-  {
-    return Vec2{ std::fabs(vec.x), std::fabs(vec.y) };
-  }
-
   float signedDistPointToInfLine(const Point& point, const Line& line)
   {
     return setDecPlaces(dotProduct(lineNormalVector(line), (point - line.end)),
@@ -731,56 +792,11 @@ namespace corex::core {
   NPolygon clippedPolygonFromTwoRects(const Rectangle& targetRect,
                                       const Rectangle& clippingRect)
   {
-    // Heck, yeah! Let's do some Sutherland-Hodgman.
-    auto targetRectPoly = convertRectangleToPolygon(targetRect);
-    auto clippingEdges = convertPolygonToLines(
-      convertRectangleToPolygon(clippingRect));
-
-    eastl::vector<Point> clippedPolyVerts;
-    for (Point& point : targetRectPoly.vertices) {
-      clippedPolyVerts.push_back(point);
-    }
-
-    eastl::vector<Point> currTargetPoly;
-    for (Line& clipEdge : clippingEdges) {
-      currTargetPoly = clippedPolyVerts;
-      clippedPolyVerts.clear();
+    NPolygon clippedPolygon;
+    PolygonClipper clipper{ clippingRect };
+    clipper.clip(targetRect, clippedPolygon);
 
-      for (int32_t i = 0; i < currTargetPoly.size(); i++) {
-        Line targetLine = Line{
-          currTargetPoly[i],
-          currTargetPoly[(i + 1) % currTargetPoly.size()]
-        };
-        auto intersectionPt = intersectionOfLineandInfLine(targetLine,
-                                                           clipEdge);
-        if (floatLessEqual(signedDistPointToInfLine(targetLine.start, clipEdge),
-                           0.f)) {
-          // The start of the target line is inside the clip edge.
-          clippedPolyVerts.push_back(targetLine.start);
-
-          if (floatGreEqual(signedDistPointToInfLine(targetLine.end, clipEdge),
-                            0.f)) {
-            // There should be an intersection point here since the start
-            // and end points of the target line are in opposite sides of the
-            // clipping edge.
-            if (intersectionPt.status == ReturnState::RETURN_OK) {
-              clippedPolyVerts.push_back(intersectionPt.value);
-            }
-          }
-        } else if (floatLessEqual(
-            signedDistPointToInfLine(targetLine.end, clipEdge), 0.f)) {
-          // The end of the target line is inside the clip edge.
-          // There should be an intersection point here since the start
-          // and end points of the target line are in opposite sides of the
-          // clipping edge.
-          if (intersectionPt.status == ReturnState::RETURN_OK) {
-            clippedPolyVerts.push_back(intersectionPt.value);
-          }
-        }
-      }
-    }
-
-    return NPolygon{ clippedPolyVerts };
+    return clippedPolygon;
   }
 
   Point getRandomPointInTriangle(const Polygon<3>& triangle)
@@ -806,6 +822,133 @@ namespace corex::core {
     return ((u0 * a) + (u1 * b)) + p0;
   }
 
+  PreparedPolygon preparePolygon(const NPolygon& polygon)
+  {
+    PreparedPolygon preparedPolygon;
+    preparedPolygon.polygon = polygon;
+
+    auto& vertices = polygon.vertices;
+    const int32_t numVertices = vertices.size();
+    assert(numVertices >= 3);
+
+    // Compute the signed area and the centroid in one pass. The centroid
+    // formula is from "Calculating the area and centroid of a polygon" by Paul
+    // Bourke. URL: http://paulbourke.net/geometry/polygonmesh/
+    double signedArea = 0.0;
+    double centroidX = 0.0;
+    double centroidY = 0.0;
+    for (int32_t i = 0, j = numVertices - 1; i < numVertices; j = i++) {
+      const double crossTerm =
+        (static_cast<double>(vertices[j].x) * vertices[i].y)
+        - (static_cast<double>(vertices[i].x) * vertices[j].y);
+      signedArea += crossTerm;
+      centroidX += (static_cast<double>(vertices[j].x) + vertices[i].x)
+                   * crossTerm;
+      centroidY += (static_cast<double>(vertices[j].y) + vertices[i].y)
+                   * crossTerm;
+    }
+    signedArea /= 2.0;
+
+    preparedPolygon.isCounterclockwise = signedArea >= 0.0;
+    preparedPolygon.area = fabs(signedArea);
+    if (floatAbsEquals(signedArea, 0.f)) {
+      // The formula divides by the area, so polygons with no area (e.g. ones
+      // whose vertices are all on a line) get the average of their vertices
+      // instead.
+      centroidX = 0.0;
+      centroidY = 0.0;
+      for (const Point& vertex : vertices) {
+        centroidX += vertex.x;
+        centroidY += vertex.y;
+      }
+
+      preparedPolygon.centroid = Point{
+        static_cast<float>(centroidX / numVertices),
+        static_cast<float>(centroidY / numVertices)
+      };
+    } else {
+      preparedPolygon.centroid = Point{
+        static_cast<float>(centroidX / (6.0 * signedArea)),
+        static_cast<float>(centroidY / (6.0 * signedArea))
+      };
+    }
+    preparedPolygon.bounds = getPolygonAABB(polygon);
+
+    const float orientation = (preparedPolygon.isCounterclockwise) ? 1.f : -1.f;
+    preparedPolygon.edgeNormals.resize(numVertices);
+    for (int32_t i = 0; i < numVertices; i++) {
+      Vec2 edge = vertices[(i + 1) % numVertices] - vertices[i];
+      if (edge.x == 0.f && edge.y == 0.f) {
+        // Repeated vertices make an edge with no direction, and so no normal.
+        preparedPolygon.edgeNormals[i] = Vec2{ 0.f, 0.f };
+        continue;
+      }
+
+      preparedPolygon.edgeNormals[i] = unitVector(
+        Vec2{ orientation * edge.y, -orientation * edge.x });
+    }
+
+    preparedPolygon.interiorAngles = computePolygonInteriorAngles(polygon);
+    preparedPolygon.isReflex.resize(numVertices);
+    preparedPolygon.isConvex = true;
+    for (int32_t i = 0; i < numVertices; i++) {
+      // Same criteria as in findReflexVertexIndexes(), which the ear clipper
+      // needs. A straight angle still leaves the polygon convex though.
+      const float angle = preparedPolygon.interiorAngles[i];
+      preparedPolygon.isReflex[i] = floatGreEqual(angle, 180);
+      if (floatGreater(angle, 180)) {
+        preparedPolygon.isConvex = false;
+      }
+    }
+
+    return preparedPolygon;
+  }
+
+  AABB getPolygonAABB(const NPolygon& polygon)
+  {
+    auto& vertices = polygon.vertices;
+    AABB aabb{ vertices[0], vertices[0] };
+    for (int32_t i = 1; i < vertices.size(); i++) {
+      aabb.minPt.x = eastl::min(aabb.minPt.x, vertices[i].x);
+      aabb.minPt.y = eastl::min(aabb.minPt.y, vertices[i].y);
+      aabb.maxPt.x = eastl::max(aabb.maxPt.x, vertices[i].x);
+      aabb.maxPt.y = eastl::max(aabb.maxPt.y, vertices[i].y);
+    }
+
+    return aabb;
+  }
+
+  AABB getRectangleAABB(const Rectangle& rect)
+  {
+    auto rectPoly = convertRectangleToPolygon(rect);
+    AABB aabb{ rectPoly.vertices[0], rectPoly.vertices[0] };
+    for (int32_t i = 1; i < rectPoly.vertices.size(); i++) {
+      aabb.minPt.x = eastl::min(aabb.minPt.x, rectPoly.vertices[i].x);
+      aabb.minPt.y = eastl::min(aabb.minPt.y, rectPoly.vertices[i].y);
+      aabb.maxPt.x = eastl::max(aabb.maxPt.x, rectPoly.vertices[i].x);
+      aabb.maxPt.y = eastl::max(aabb.maxPt.y, rectPoly.vertices[i].y);
+    }
+
+    return aabb;
+  }
+
+  bool areTwoAABBsIntersecting(const AABB& aabb0, const AABB& aabb1)
+  {
+    return aabb0.minPt.x <= aabb1.maxPt.x && aabb0.maxPt.x >= aabb1.minPt.x
+           && aabb0.minPt.y <= aabb1.maxPt.y && aabb0.maxPt.y >= aabb1.minPt.y;
+  }
+
+  bool isPointWithinAABB(const Point& point, const AABB& aabb)
+  {
+    return point.x >= aabb.minPt.x && point.x <= aabb.maxPt.x
+           && point.y >= aabb.minPt.y && point.y <= aabb.maxPt.y;
+  }
+
+  double getPolygonArea(const PreparedPolygon& polygon)
+  {
+    return polygon.area;
+  }
+
   Point getPolygonCentroid(const NPolygon& polygon)
   {
     // From "Calculating the area and centroid of a polygon" by Paul Bourke.
@@ -861,11 +1004,21 @@ namespace corex::core {
     };
   }
 
+  Point getPolygonCentroid(const PreparedPolygon& polygon)
+  {
+    return polygon.centroid;
+  }
+
   int32_t getNumNPolygonSides(const NPolygon& polygon)
   {
     return polygon.vertices.size();
   }
 
+  int32_t getNumNPolygonSides(const PreparedPolygon& polygon)
+  {
+    return polygon.polygon.vertices.size();
+  }
+
   bool isPointWithinNPolygon(const Point& point, const NPolygon& polygon)
   {
     // Code based from:
@@ -892,6 +1045,29 @@ namespace corex::core {
     return isPointInside;
   }
 
+  bool isPointWithinNPolygon(const Point& point,
+                             const PreparedPolygon& polygon)
+  {
+    if (!isPointWithinAABB(point, polygon.bounds)) {
+      return false;
+    }
+
+    if (!polygon.isConvex) {
+      return isPointWithinNPolygon(point, polygon.polygon);
+    }
+
+    // A point is inside a convex polygon if it is not in front of any of the
+    // polygon's edges.
+    auto& vertices = polygon.polygon.vertices;
+    for (int32_t i = 0; i < vertices.size(); i++) {
+      if (dotProduct(polygon.edgeNormals[i], point - vertices[i]) > 0.f) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   bool isRectWithinNPolygon(const Rectangle& rect, const NPolygon& polygon)
   {
     auto rectPoly = convertRectangleToPolygon(rect);
@@ -923,6 +1099,28 @@ namespace corex::core {
     return isPointWithinNPolygon(rectPoly.vertices[0], polygon);
   }
 
+  bool isRectWithinNPolygon(const Rectangle& rect,
+                            const PreparedPolygon& polygon)
+  {
+    if (!areTwoAABBsIntersecting(getRectangleAABB(rect), polygon.bounds)) {
+      return false;
+    }
+
+    if (!polygon.isConvex) {
+      return isRectWithinNPolygon(rect, polygon.polygon);
+    }
+
+    // A rectangle is within a convex polygon if all of its corners are.
+    auto rectPoly = convertRectangleToPolygon(rect);
+    for (const Point& rectVertex : rectPoly.vertices) {
+      if (!isPointWithinNPolygon(rectVertex, polygon)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   bool isRectWithinNPolygonAABB(const Rectangle& rect, const NPolygon& polygon)
   {
     // We are assuming the NPolygon is a quadrilateral.
@@ -1000,6 +1198,16 @@ namespace corex::core {
     return isPointWithinNPolygon(rectPoly.vertices[0], polygon);
   }
 
+  bool isRectIntersectingNPolygon(const Rectangle& rect,
+                                  const PreparedPolygon& polygon)
+  {
+    if (!areTwoAABBsIntersecting(getRectangleAABB(rect), polygon.bounds)) {
+      return false;
+    }
+
+    return isRectIntersectingNPolygon(rect, polygon.polygon);
+  }
+
   Polygon<4> getIntersectingRectAABB(const Rectangle& rect0,
                                      const Rectangle& rect1)
   {
@@ -1042,148 +1250,143 @@ namespace corex::core {
     return Polygon<4>{};
   }
 
-  eastl::vector<Polygon<3>> earClipTriangulate(NPolygon polygon)
+  eastl::vector<Polygon<3>> earClipTriangulate(const NPolygon& polygon)
   {
-    // TODO: Tweak this triangulation method.
-    // We are iterating through the vertices in a counterclockwise manner when
-    // the origin is on the bottom right.
     eastl::vector<Polygon<3>> triangles;
-    auto& vertices = polygon.vertices;
-    int32_t numTriangles = vertices.size() - 2;
-
-    // It's triangulation time!
-    auto vertexAngles = computePolygonInteriorAngles(polygon);
-    auto earVertexIndexes = findEarVertexIndexes(polygon);
-    const auto convexVertexIndexes = findConvexVertexIndexes(polygon);
-    const auto reflexVertexIndexes = findReflexVertexIndexes(polygon);
-    eastl::set<int32_t> earVertexIndexesSet(earVertexIndexes.begin(),
-                                            earVertexIndexes.end());
-    eastl::set<int32_t> convexVertexIndexesSet(convexVertexIndexes.begin(),
-                                               convexVertexIndexes.end());
-    eastl::set<int32_t> reflexVertexIndexesSet(reflexVertexIndexes.begin(),
-                                               reflexVertexIndexes.end());
-
-    while (true) {
-      // Using ears from the back removes the need for us to the update the
-      // vertex indexes in the ear vertex indexes vector when deleting ears.
-      int32_t targetEarIndex = earVertexIndexes.back();
-
-      // Add triangle.
-      int32_t prevVertexIndex = mod(targetEarIndex - 1, vertices.size());
-      int32_t nextVertexIndex = mod(targetEarIndex + 1, vertices.size());
+    earClipTriangulate(polygon, triangles);
+
+    return triangles;
+  }
+
+  void earClipTriangulate(const NPolygon& polygon,
+                          eastl::vector<Polygon<3>>& triangles)
+  {
+    // The remaining vertices of the polygon are kept in a doubly-linked list
+    // of vertex indexes. Removing an ear is O(1), and only the two neighbours
+    // of a removed ear need to be updated. We also only need to check the
+    // reflex vertices when testing if a vertex is an ear, since a triangle
+    // can only contain a vertex of the polygon if it contains a reflex vertex.
+    triangles.clear();
+
+    const auto& vertices = polygon.vertices;
+    const int32_t numVertices = vertices.size();
+    if (numVertices < 3) {
+      return;
+    }
+
+    triangles.reserve(numVertices - 2);
+
+    // We only need the sign of the area to know how the polygon is oriented.
+    double signedArea = 0.0;
+    for (int32_t i = 0, j = numVertices - 1; i < numVertices; j = i++) {
+      signedArea += (static_cast<double>(vertices[j].x) * vertices[i].y)
+                    - (static_cast<double>(vertices[i].x) * vertices[j].y);
+    }
+
+    const double orientation = (signedArea >= 0.0) ? 1.0 : -1.0;
+
+    eastl::vector<int32_t> prevIndexes(numVertices);
+    eastl::vector<int32_t> nextIndexes(numVertices);
+    eastl::vector<bool> isReflex(numVertices, false);
+    eastl::vector<int32_t> reflexIndexes;
+    for (int32_t i = 0; i < numVertices; i++) {
+      prevIndexes[i] = (i == 0) ? numVertices - 1 : i - 1;
+      nextIndexes[i] = (i == numVertices - 1) ? 0 : i + 1;
+    }
+
+    for (int32_t i = 0; i < numVertices; i++) {
+      if (_isLinkedVertexReflex(vertices[prevIndexes[i]],
+                                vertices[i],
+                                vertices[nextIndexes[i]],
+                                orientation)) {
+        isReflex[i] = true;
+        reflexIndexes.push_back(i);
+      }
+    }
+
+    int32_t currIndex = 0;
+    int32_t numRemainingVertices = numVertices;
+    int32_t numVerticesChecked = 0;
+    while (numRemainingVertices > 3) {
+      const int32_t prevIndex = prevIndexes[currIndex];
+      const int32_t nextIndex = nextIndexes[currIndex];
+
+      // If we went through all remaining vertices without finding an ear, the
+      // polygon is degenerate (e.g. it has collinear or duplicate vertices).
+      // Clip the current vertex anyway so that we always terminate.
+      bool isCurrVertexClippable = numVerticesChecked >= numRemainingVertices;
+      if (!isCurrVertexClippable && !isReflex[currIndex]) {
+        isCurrVertexClippable = _isLinkedVertexAnEar(vertices,
+                                                     prevIndex,
+                                                     currIndex,
+                                                     nextIndex,
+                                                     reflexIndexes,
+                                                     orientation);
+      }
+
+      if (!isCurrVertexClippable) {
+        currIndex = nextIndex;
+        numVerticesChecked++;
+        continue;
+      }
 
       triangles.push_back({
         {
-          vertices[targetEarIndex],
-          vertices[nextVertexIndex],
-          vertices[prevVertexIndex]
+          vertices[currIndex],
+          vertices[nextIndex],
+          vertices[prevIndex]
         }
       });
 
-      // Remove ear.
-      earVertexIndexes.pop_back();
-      earVertexIndexesSet.erase(targetEarIndex);
-      convexVertexIndexesSet.erase(targetEarIndex);
-      vertices.erase(vertices.begin() + targetEarIndex);
+      // Remove the ear from the polygon.
+      nextIndexes[prevIndex] = nextIndex;
+      prevIndexes[nextIndex] = prevIndex;
+      numRemainingVertices--;
+      numVerticesChecked = 0;
 
-      if (triangles.size() == numTriangles) {
-        break;
+      if (isReflex[currIndex]) {
+        // Only happens with degenerate polygons.
+        isReflex[currIndex] = false;
+        _removeReflexVertexIndex(reflexIndexes, currIndex);
       }
 
-      // Update the indexes of the vertices succeeding the newly-removed ear, if
-      // the ear is not the last vertex of the polygon, because the vertex
-      // indexes will remain the same post-removal if it is so.
-      if (nextVertexIndex != 0) {
-        for (int32_t i = nextVertexIndex; i < vertices.size(); i++) {
-          if (isKeyInSet(reflexVertexIndexesSet, i)) {
-            reflexVertexIndexesSet.erase(i);
-            reflexVertexIndexesSet.insert(i - 1);
-          } else if (isKeyInSet(convexVertexIndexesSet, i)) {
-            convexVertexIndexesSet.erase(i);
-            convexVertexIndexesSet.insert(i - 1);
-
-            // NOTE: An ear is always a convex, but a convex vertex is not always
-            //       an ear.
-            if (isKeyInSet(earVertexIndexesSet, i)) {
-              earVertexIndexesSet.erase(i);
-              earVertexIndexesSet.insert(i - 1);
-
-              auto iter = eastl::find(earVertexIndexes.begin(),
-                                      earVertexIndexes.end(),
-                                      i);
-              if (iter != earVertexIndexes.end()) {
-                (*iter)--;
-              }
-            }
-          }
+      // A reflex vertex may become convex once one of its neighbours gets
+      // removed. A convex vertex, however, stays convex.
+      eastl::array<int32_t, 2> adjacentIndexes = { prevIndex, nextIndex };
+      for (int32_t idx : adjacentIndexes) {
+        if (isReflex[idx]
+            && !_isLinkedVertexReflex(vertices[prevIndexes[idx]],
+                                      vertices[idx],
+                                      vertices[nextIndexes[idx]],
+                                      orientation)) {
+          isReflex[idx] = false;
+          _removeReflexVertexIndex(reflexIndexes, idx);
         }
-
-        nextVertexIndex--;
       }
 
-      // Update vertex angles.
-      // TODO: Optimize this so that only the angles of the vertices adjacent
-      //       to the newly-removed ear vertex are recomputed.
-      vertexAngles = computePolygonInteriorAngles(polygon);
+      // The previous vertex might have just turned into an ear, so let's check
+      // it first.
+      currIndex = prevIndex;
+    }
 
-      // Update status of adjacent vertices of newly-removed ear.
-      eastl::array<int32_t, 2> adjacentIndexes = {
-        prevVertexIndex,
-        nextVertexIndex
-      };
-      for (int32_t idx : adjacentIndexes) {
-        if (isKeyInSet(earVertexIndexesSet, idx)) {
-          // Vertex is an ear. It might still be an ear or not. Check to
-          // confirm.
-          if (!isVertexAnEarInPolygon(idx, polygon)) {
-            // Oh, no. It's no longer an ear. No need to remove the vertex from
-            // the set of convex vertices though. Even though it is no longer an
-            // ear, a convex vertex will remain a convex.
-            // Yep, it's that loyal (unlike your ex).
-
-            earVertexIndexesSet.erase(idx);
-            auto iter = eastl::find(earVertexIndexes.begin(),
-                                    earVertexIndexes.end(),
-                                    idx);
-            if (iter != earVertexIndexes.end()) {
-              earVertexIndexes.erase(iter);
-            }
-          }
-        } else if (isKeyInSet(convexVertexIndexesSet, idx)) {
-          // Vertex is a convex but not an ear. It will still be convex, but
-          // let's check if it has turned into an ear.
-          if (isVertexAnEarInPolygon(idx, polygon)) {
-            // Let's make sure that we do not add duplicates to the data
-            // structures holding information about ear vertices.
-            if (!isKeyInSet(earVertexIndexesSet, idx)) {
-              earVertexIndexes.push_back(idx);
-              earVertexIndexesSet.insert(idx);
-            }
-          }
-        } else if (isKeyInSet(reflexVertexIndexesSet, idx)) {
-          // Vertex is a reflex. It might have turned into an ear or a convex.
-          // Check to confirm. Check first if the vertex has turned into a
-          // convex vertex.
-          if (floatLessThan(vertexAngles[idx], 180)) {
-            // The vertex has become a convex vertex.
-            reflexVertexIndexesSet.erase(idx);
-            convexVertexIndexesSet.insert(idx);
-
-            // Let's check if it's an ear now.
-            if (isVertexAnEarInPolygon(idx, polygon)) {
-              // Let's make sure that we do not add duplicates to the data
-              // structures holding information about ear vertices.
-              if (!isKeyInSet(earVertexIndexesSet, idx)) {
-                earVertexIndexes.push_back(idx);
-                earVertexIndexesSet.insert(idx);
-              }
-            }
-          }
-        }
+    triangles.push_back({
+      {
+        vertices[currIndex],
+        vertices[nextIndexes[currIndex]],
+        vertices[prevIndexes[currIndex]]
       }
-    }
+    });
+  }
 
-    return triangles;
+  eastl::vector<Polygon<3>> earClipTriangulate(const PreparedPolygon& polygon)
+  {
+    return earClipTriangulate(polygon.polygon);
+  }
+
+  void earClipTriangulate(const PreparedPolygon& polygon,
+                          eastl::vector<Polygon<3>>& triangles)
+  {
+    earClipTriangulate(polygon.polygon, triangles);
   }
 
   eastl::vector<int32_t> findEarVertexIndexes(const NPolygon& polygon)
@@ -1213,6 +1416,19 @@ namespace corex::core {
     return convexVertexIndexes;
   }
 
+  eastl::vector<int32_t> findConvexVertexIndexes(
+    const PreparedPolygon& polygon)
+  {
+    eastl::vector<int32_t> convexVertexIndexes;
+    for (int32_t i = 0; i < polygon.isReflex.size(); i++) {
+      if (!polygon.isReflex[i]) {
+        convexVertexIndexes.push_back(i);
+      }
+    }
+
+    return convexVertexIndexes;
+  }
+
   eastl::vector<int32_t> findReflexVertexIndexes(const NPolygon& polygon)
   {
     eastl::vector<int32_t> reflexVertexIndexes;
@@ -1226,6 +1442,19 @@ namespace corex::core {
     return reflexVertexIndexes;
   }
 
+  eastl::vector<int32_t> findReflexVertexIndexes(
+    const PreparedPolygon& polygon)
+  {
+    eastl::vector<int32_t> reflexVertexIndexes;
+    for (int32_t i = 0; i < polygon.isReflex.size(); i++) {
+      if (polygon.isReflex[i]) {
+        reflexVertexIndexes.push_back(i);
+      }
+    }
+
+    return reflexVertexIndexes;
+  }
+
   eastl::vector<float> computePolygonInteriorAngles(const NPolygon& polygon)
   {
     // We are iterating through the vertices in a counterclockwise manner when
@@ -1272,6 +1501,12 @@ namespace corex::core {
     return angles;
   }
 
+  const eastl::vector<float>& computePolygonInteriorAngles(
+    const PreparedPolygon& polygon)
+  {
+    return polygon.interiorAngles;
+  }
+
   bool isVertexAnEarInPolygon(const int32_t & vertexIndex,
                               const NPolygon& polygon)
   {
@@ -14,10 +14,12 @@
 
 #include <corex/core/ReturnValue.hpp>
 #include <corex/core/utils.hpp>
+#include <corex/core/ds/AABB.hpp>
 #include <corex/core/ds/Line.hpp>
 #include <corex/core/ds/NPolygon.hpp>
 #include <corex/core/ds/Point.hpp>
 #include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
 #include <corex/core/ds/Rectangle.hpp>
 #include <corex/core/ds/Vec2.hpp>
 #include <corex/core/ds/VecN.hpp>
@@ -93,30 +95,75 @@ namespace corex::core
   float lineSlope(const Line& line);
   Line longestLine(const eastl::vector<Line*> lines);
 
-  float det3x3(const Vec2& v0, const Vec2& v1, const Vec2& v2);
+  constexpr float det3x3(const Vec2& v0, const Vec2& v1, const Vec2& v2)
+  {
+    return ((v1.x * v2.y) + (v0.x * v1.y) + (v0.y * v2.x))
+           - ((v0.y * v1.x) + (v1.y * v2.x) + (v0.x * v2.y));
+  }
+
   float vec2Magnitude(const Vec2& p);
   float vec2Angle(const Vec2& p);
-  float dotProduct(const Vec2& p, const Vec2& q);
-  float crossProduct(const Vec2& p, const Vec2& q);
+
+  constexpr float dotProduct(const Vec2& p, const Vec2& q)
+  {
+    return (p.x * q.x) + (p.y * q.y);
+  }
+
+  constexpr float crossProduct(const Vec2& p, const Vec2& q)
+  {
+    return (p.x * q.y) - (p.y * q.x);
+  }
+
   float angleBetweenTwoVectors(const Vec2& p, const Vec2& q);
   Vec2 rotateVec2(const Vec2& p, float angle);
   Vec2 projectVec2(const Vec2& p, const Vec2& q);
   Vec2 vec2Perp(const Vec2& p);
-  Vec2 translateVec2(const Vec2& vec, float deltaX, float deltaY);
+
+  constexpr Vec2 translateVec2(const Vec2& vec, float deltaX, float deltaY)
+  {
+    return Vec2{vec.x + deltaX, vec.y + deltaY};
+  }
+
   Vec2 minVec2Magnitude(const eastl::vector<Vec2*> vectors);
   Vec2 maxVec2Magnitude(const eastl::vector<Vec2*> vectors);
   Vec2 unitVector(const Vec2& vec);
-  Vec2 lineToVec(const Line& line);
+
+  constexpr Vec2 lineToVec(const Line& line)
+  {
+    return Vec2{ line.end.x - line.start.x, line.end.y - line.start.y };
+  }
+
   Vec2 lineDirectionVector(const Line& line);
   Vec2 lineNormalVector(const Line& line);
   VecN pairwiseMult(const VecN& p, const VecN& q);
   VecN pairwiseSubt(const VecN& p, const float& a);
   VecN pairwiseSubt(const float& a, const VecN& p);
   VecN vecNAbs(const VecN& vec);
-  Vec2 pairwiseMult(const Vec2& p, const Vec2& q);
-  Vec2 pairwiseSubt(const Vec2& p, const float& a);
-  Vec2 pairwiseSubt(const float& a, const Vec2& p);
-  Vec2 vec2Abs(const Vec2& vec);
+
+  // The Vec2 versions of the functions below are called in hot loops (e.g. in
+  // GWO::optimize()), so we are defining them here to let them be inlined.
+  constexpr Vec2 pairwiseMult(const Vec2& p, const Vec2& q)
+  {
+    return Vec2{ p.x * q.x, p.y * q.y };
+  }
+
+  constexpr Vec2 pairwiseSubt(const Vec2& p, const float& a)
+  {
+    return Vec2{ p.x - a, p.y - a };
+  }
+
+  constexpr Vec2 pairwiseSubt(const float& a, const Vec2& p)
+  {
+    return Vec2{ a - p.x, a - p.y };
+  }
+
+  constexpr Vec2 vec2Abs(const Vec2& vec)
+  {
+    return Vec2{
+      (vec.x < 0.f) ? -vec.x : vec.x,
+      (vec.y < 0.f) ? -vec.y : vec.y
+    };
+  }
 
   template <typename... Args>
   inline constexpr auto rotatePoint(Args&&... args)
@@ -162,22 +209,47 @@ namespace corex::core
   NPolygon clippedPolygonFromTwoRects(const Rectangle& targetRect,
                                       const Rectangle& clippingRect);
   Point getRandomPointInTriangle(const Polygon<3>& triangle);
+  PreparedPolygon preparePolygon(const NPolygon& polygon);
+  AABB getPolygonAABB(const NPolygon& polygon);
+  AABB getRectangleAABB(const Rectangle& rect);
+  bool areTwoAABBsIntersecting(const AABB& aabb0, const AABB& aabb1);
+  bool isPointWithinAABB(const Point& point, const AABB& aabb);
+  double getPolygonArea(const PreparedPolygon& polygon);
   Point getPolygonCentroid(const NPolygon& polygon);
+  Point getPolygonCentroid(const PreparedPolygon& polygon);
   int32_t getNumNPolygonSides(const NPolygon& polygon);
+  int32_t getNumNPolygonSides(const PreparedPolygon& polygon);
   bool isPointWithinNPolygon(const Point& point, const NPolygon& polygon);
+  bool isPointWithinNPolygon(const Point& point,
+                             const PreparedPolygon& polygon);
   bool isRectWithinNPolygon(const Rectangle& rect, const NPolygon& polygon);
+  bool isRectWithinNPolygon(const Rectangle& rect,
+                            const PreparedPolygon& polygon);
   bool isRectWithinNPolygonAABB(const Rectangle& rect, const NPolygon& polygon);
   bool isRectWithinRectAABB(const Rectangle& insideRect,
                             const Rectangle& outsideRect);
   bool isRectIntersectingNPolygon(const Rectangle& rect,
                                   const NPolygon& polygon);
+  bool isRectIntersectingNPolygon(const Rectangle& rect,
+                                  const PreparedPolygon& polygon);
   Polygon<4> getIntersectingRectAABB(const Rectangle& rect0,
                                      const Rectangle& rect1);
-  eastl::vector<Polygon<3>> earClipTriangulate(NPolygon polygon);
+  eastl::vector<Polygon<3>> earClipTriangulate(const NPolygon& polygon);
+  eastl::vector<Polygon<3>> earClipTriangulate(const PreparedPolygon& polygon);
+  void earClipTriangulate(const NPolygon& polygon,
+                          eastl::vector<Polygon<3>>& triangles);
+  void earClipTriangulate(const PreparedPolygon& polygon,
+                          eastl::vector<Polygon<3>>& triangles);
   eastl::vector<int32_t> findEarVertexIndexes(const NPolygon& polygon);
   eastl::vector<int32_t> findConvexVertexIndexes(const NPolygon& polygon);
+  eastl::vector<int32_t> findConvexVertexIndexes(
+    const PreparedPolygon& polygon);
   eastl::vector<int32_t> findReflexVertexIndexes(const NPolygon& polygon);
+  eastl::vector<int32_t> findReflexVertexIndexes(
+    const PreparedPolygon& polygon);
   eastl::vector<float> computePolygonInteriorAngles(const NPolygon& polygon);
+  const eastl::vector<float>& computePolygonInteriorAngles(
+    const PreparedPolygon& polygon);
   bool isVertexAnEarInPolygon(const int32_t & vertexIndex,
                               const NPolygon& polygon);
 
@@ -264,6 +336,37 @@ namespace corex::core
     return nPolygon;
   }
 
+  // The weighted selection functions below do a linear scan for each draw. If
+  // you need to draw many times from the same set of weights, build an
+  // AliasTable instead.
+  template <template<class, class> class W, class WAllocator>
+  int32_t selectRandomWeightedIndex(const W<float, WAllocator>& weights)
+  {
+    // Algorithm based on:
+    //   https://softwareengineering.stackexchange.com/a/150618/208923
+    float weightSum = 0.f;
+    for (const float& weight : weights) {
+      weightSum += weight;
+    }
+
+    std::uniform_real_distribution nDistrib{ 0.f, weightSum };
+    float n = generateRandomReal(nDistrib);
+    float currIntervalVal = 0.f;
+
+    // Default to the last item in case rounding errors make the interval
+    // values end up slightly smaller than n.
+    int32_t selectedItemIndex = weights.size() - 1;
+    for (int32_t i = 0; i < weights.size(); i++) {
+      currIntervalVal += weights[i];
+      if (floatGreEqual(currIntervalVal, n)) {
+        selectedItemIndex = i;
+        break;
+      }
+    }
+
+    return selectedItemIndex;
+  }
+
   // Disallow weights that are non-float.
   template <
     template<class, class> class V, class T, class VAllocator,
@@ -287,51 +390,19 @@ namespace corex::core
   > const T& selectRandomItemWithWeights(const V<T, VAllocator>& items,
                                          const W<float, WAllocator>& weights)
   {
-    // Algorithm based on:
-    //   https://softwareengineering.stackexchange.com/a/150618/208923
-    float weightSum = std::accumulate(weights.begin(), weights.end(), 0);
-    std::uniform_real_distribution nDistrib{ 0.f, weightSum };
-    float n = generateRandomReal(nDistrib);
-    int32_t currIntervalVal = 0;
-    int32_t selectedItemIndex = 0;
-    for (int32_t i = 0; i < weights.size(); i++) {
-      currIntervalVal += weights[i];
-      if (floatGreEqual(currIntervalVal, n)) {
-        selectedItemIndex = i;
-        break;
-      }
-    }
-
-    return items[selectedItemIndex];
+    return items[selectRandomWeightedIndex(weights)];
   }
 
   template <
     template<class, class> class V, class T, class VAllocator
   > const T selectItemRandomly(const V<T, VAllocator>& items)
   {
-    eastl::vector<float> weights(items.size(), 1.f);
-    return selectRandomItemWithWeights(items, weights);
-  }
-
-  template <template<class, class> class W, class WAllocator>
-  int32_t selectRandomWeightedIndex(const W<float, WAllocator>& weights)
-  {
-    // Algorithm based on:
-    //   https://softwareengineering.stackexchange.com/a/150618/208923
-    float weightSum = std::accumulate(weights.begin(), weights.end(), 0);
-    std::uniform_real_distribution nDistrib{ 0.f, weightSum };
-    float n = generateRandomReal(nDistrib);
-    int32_t currIntervalVal = 0;
-    int32_t selectedItemIndex = 0;
-    for (int32_t i = 0; i < weights.size(); i++) {
-      currIntervalVal += weights[i];
-      if (floatGreEqual(currIntervalVal, n)) {
-        selectedItemIndex = i;
-        break;
-      }
-    }
-
-    return selectedItemIndex;
+    // All items have the same weight, so there's no need to go through the
+    // weights.
+    std::uniform_int_distribution<int32_t> indexDistrib{
+      0, static_cast<int32_t>(items.size()) - 1
+    };
+    return items[generateRandomInt(indexDistrib)];
   }
 
   template <class RealType>
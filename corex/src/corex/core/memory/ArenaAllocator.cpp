@@ -0,0 +1,76 @@
+#include <cassert>
+#include <cstddef>
+
+#include <corex/core/memory/ArenaAllocator.hpp>
+#include <corex/core/memory/LinearArena.hpp>
+#include <corex/core/memory/memory_functions.hpp>
+
+namespace corex::core
+{
+  ArenaAllocator::ArenaAllocator(const char* name)
+    : ArenaAllocator(&getFrameArena(), name) {}
+
+  ArenaAllocator::ArenaAllocator(LinearArena* arena, const char* name)
+    : arena(arena)
+    , name(name) {}
+
+  ArenaAllocator::ArenaAllocator(const ArenaAllocator& allocator)
+    : arena(allocator.arena)
+    , name(allocator.name) {}
+
+  ArenaAllocator::ArenaAllocator(const ArenaAllocator& allocator,
+                                 const char* name)
+    : arena(allocator.arena)
+    , name(name) {}
+
+  ArenaAllocator& ArenaAllocator::operator=(const ArenaAllocator& allocator)
+  {
+    this->arena = allocator.arena;
+    return *this;
+  }
+
+  void* ArenaAllocator::allocate(size_t n, int flags)
+  {
+    return this->arena->allocate(n);
+  }
+
+  void* ArenaAllocator::allocate(size_t n,
+                                 size_t alignment,
+                                 size_t offset,
+                                 int flags)
+  {
+    // EASTL only asks for an offset in containers we don't use.
+    assert(offset == 0);
+    return this->arena->allocate(n, alignment);
+  }
+
+  void ArenaAllocator::deallocate(void* p, size_t n)
+  {
+    // Nothing to do here. The memory gets freed once the arena is reset.
+  }
+
+  const char* ArenaAllocator::get_name() const
+  {
+    return this->name;
+  }
+
+  void ArenaAllocator::set_name(const char* name)
+  {
+    this->name = name;
+  }
+
+  LinearArena* ArenaAllocator::getArena() const
+  {
+    return this->arena;
+  }
+
+  bool operator==(const ArenaAllocator& a, const ArenaAllocator& b)
+  {
+    return a.getArena() == b.getArena();
+  }
+
+  bool operator!=(const ArenaAllocator& a, const ArenaAllocator& b)
+  {
+    return !(a == b);
+  }
+}
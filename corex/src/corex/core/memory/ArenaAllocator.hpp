@@ -0,0 +1,52 @@
+#ifndef COREX_CORE_MEMORY_ARENA_ALLOCATOR_HPP
+#define COREX_CORE_MEMORY_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+
+#include <corex/core/memory/LinearArena.hpp>
+
+namespace corex::core
+{
+  // An EASTL allocator that allocates from a LinearArena. This lets EASTL
+  // containers opt into an arena, e.g.:
+  //
+  //   eastl::vector<Point, ArenaAllocator> points{ ArenaAllocator{ &arena } };
+  //
+  // Deallocation does nothing, since the memory is only freed once the arena
+  // gets reset. Containers using this allocator must not outlive the arena's
+  // next reset. By default, the frame arena is used.
+  class ArenaAllocator
+  {
+  public:
+    explicit ArenaAllocator(const char* name = "Arena Allocator");
+    explicit ArenaAllocator(LinearArena* arena,
+                            const char* name = "Arena Allocator");
+    ArenaAllocator(const ArenaAllocator& allocator);
+    ArenaAllocator(const ArenaAllocator& allocator, const char* name);
+
+    ArenaAllocator& operator=(const ArenaAllocator& allocator);
+
+    void* allocate(size_t n, int flags = 0);
+    void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0);
+    void deallocate(void* p, size_t n);
+
+    const char* get_name() const;
+    void set_name(const char* name);
+
+    LinearArena* getArena() const;
+
+  private:
+    LinearArena* arena;
+    const char* name;
+  };
+
+  bool operator==(const ArenaAllocator& a, const ArenaAllocator& b);
+  bool operator!=(const ArenaAllocator& a, const ArenaAllocator& b);
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include <EASTL/vector.h>
+
+#include <corex/core/memory/LinearArena.hpp>
+#include <corex/core/memory/memory_functions.hpp>
+
+namespace corex::core
+{
+  // All blocks are aligned to this. Bigger alignments are handled by padding
+  // within the block.
+  constexpr size_t blockAlignment = 64;
+
+  LinearArena::LinearArena(size_t blockSize, const char* name)
+    : blocks()
+    , blockSize(blockSize)
+    , currBlockOffset(0)
+    , numBytesUsedInPrevBlocks(0)
+    , name(name)
+  {
+    this->addBlock(blockSize);
+  }
+
+  LinearArena::~LinearArena()
+  {
+    for (Block& block : this->blocks) {
+      freeAligned(block.data);
+    }
+  }
+
+  void* LinearArena::allocate(size_t size, size_t alignment)
+  {
+    // Alignments must be a power of two.
+    assert((alignment & (alignment - 1)) == 0);
+
+    Block* currBlock = &(this->blocks.back());
+    uintptr_t blockStart = reinterpret_cast<uintptr_t>(currBlock->data);
+    uintptr_t alignedAddress = (blockStart + this->currBlockOffset
+                                + (alignment - 1))
+                               & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t newOffset = (alignedAddress - blockStart) + size;
+    if (newOffset > currBlock->size) {
+      // Does not fit, so we need a new block. Make sure that the block can
+      // hold the allocation even with the padding needed for its alignment.
+      this->numBytesUsedInPrevBlocks += this->currBlockOffset;
+      this->addBlock(size + alignment);
+
+      currBlock = &(this->blocks.back());
+      blockStart = reinterpret_cast<uintptr_t>(currBlock->data);
+      alignedAddress = (blockStart + (alignment - 1))
+                       & ~(static_cast<uintptr_t>(alignment) - 1);
+      newOffset = (alignedAddress - blockStart) + size;
+    }
+
+    this->currBlockOffset = newOffset;
+
+    return reinterpret_cast<void*>(alignedAddress);
+  }
+
+  void LinearArena::reset()
+  {
+    if (this->blocks.size() > 1) {
+      // Merge all the blocks into one, so that we don't have to allocate new
+      // blocks again next time.
+      size_t totalCapacity = this->getCapacity();
+      for (Block& block : this->blocks) {
+        freeAligned(block.data);
+      }
+      this->blocks.clear();
+
+      this->addBlock(totalCapacity);
+    }
+
+    this->currBlockOffset = 0;
+    this->numBytesUsedInPrevBlocks = 0;
+  }
+
+  size_t LinearArena::getNumBytesUsed() const
+  {
+    return this->numBytesUsedInPrevBlocks + this->currBlockOffset;
+  }
+
+  size_t LinearArena::getCapacity() const
+  {
+    size_t capacity = 0;
+    for (const Block& block : this->blocks) {
+      capacity += block.size;
+    }
+
+    return capacity;
+  }
+
+  int32_t LinearArena::getNumBlocks() const
+  {
+    return this->blocks.size();
+  }
+
+  const char* LinearArena::getName() const
+  {
+    return this->name;
+  }
+
+  void LinearArena::addBlock(size_t minSize)
+  {
+    size_t newBlockSize = (minSize > this->blockSize) ? minSize
+                                                      : this->blockSize;
+    char* data = static_cast<char*>(allocateAligned(newBlockSize,
+                                                    blockAlignment));
+    assert(data != nullptr);
+
+    this->blocks.push_back(Block{ data, newBlockSize });
+    this->currBlockOffset = 0;
+  }
+}
@@ -0,0 +1,68 @@
+#ifndef COREX_CORE_MEMORY_LINEAR_ARENA_HPP
+#define COREX_CORE_MEMORY_LINEAR_ARENA_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include <EASTL/vector.h>
+
+namespace corex::core
+{
+  // A linear (bump) allocator. Allocations are just pointer increments, and
+  // nothing is freed individually. Everything is freed at once with reset().
+  // If an allocation does not fit in the current block, a new block is
+  // allocated. On reset(), the blocks get merged into a single block big
+  // enough to hold everything, so an arena that is reset regularly (e.g. every
+  // frame) stops touching the heap once it has grown to its working size.
+  class LinearArena
+  {
+  public:
+    explicit LinearArena(size_t blockSize = 64 * 1024,
+                         const char* name = "Linear Arena");
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(max_align_t));
+
+    template <class T>
+    T* allocateArray(size_t numElements)
+    {
+      // Objects are not constructed, so only use this for types that do not
+      // need it.
+      return static_cast<T*>(this->allocate(sizeof(T) * numElements,
+                                            alignof(T)));
+    }
+
+    void reset();
+
+    size_t getNumBytesUsed() const;
+    size_t getCapacity() const;
+    int32_t getNumBlocks() const;
+    const char* getName() const;
+
+  private:
+    struct Block
+    {
+      char* data;
+      size_t size;
+    };
+
+    void addBlock(size_t minSize);
+
+    eastl::vector<Block> blocks;
+    size_t blockSize;
+    size_t currBlockOffset;
+    size_t numBytesUsedInPrevBlocks;
+    const char* name;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include <EASTL/array.h>
+
+#include <corex/core/memory/allocation_tracking.hpp>
+#include <corex/core/memory/memory_functions.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  namespace
+  {
+    struct AllocationCounters
+    {
+      const char* name;
+      std::atomic<uint64_t> numAllocations;
+      std::atomic<uint64_t> numDeallocations;
+      std::atomic<uint64_t> numBytesAllocated;
+      std::atomic<int64_t> numLiveBytes;
+      std::atomic<int64_t> peakNumLiveBytes;
+    };
+
+    // Stored right before every tracked allocation.
+    struct AllocationHeader
+    {
+      uint64_t size;
+      uint32_t tag;
+      uint32_t offset; // Distance from the start of the raw allocation.
+    };
+  }
+
+  // Keep the user pointer aligned to at least max_align_t.
+  constexpr size_t _minHeaderPadding = alignof(max_align_t);
+  static_assert(sizeof(AllocationHeader) <= _minHeaderPadding);
+
+  // None of these can allocate, since they are used by operator new.
+  eastl::array<AllocationCounters, maxNumAllocationTags> _allocationCounters;
+  std::atomic<int32_t> _numAllocationTags{ 1 };
+  thread_local int32_t _currAllocationTag = untaggedAllocationTag;
+  /////////////////////////////////////////////////
+
+  int32_t registerAllocationTag(const char* name)
+  {
+    int32_t tag = _numAllocationTags.fetch_add(1);
+    if (tag >= maxNumAllocationTags) {
+      _numAllocationTags.store(maxNumAllocationTags);
+      return untaggedAllocationTag;
+    }
+
+    _allocationCounters[tag].name = name;
+    return tag;
+  }
+
+  int32_t getNumAllocationTags()
+  {
+    return _numAllocationTags.load();
+  }
+
+  const char* getAllocationTagName(int32_t tag)
+  {
+    if (tag == untaggedAllocationTag) {
+      return "Untagged";
+    }
+
+    return _allocationCounters[tag].name;
+  }
+
+  AllocationStats getAllocationStats(int32_t tag)
+  {
+    const AllocationCounters& counters = _allocationCounters[tag];
+    return AllocationStats{
+      counters.numAllocations.load(std::memory_order_relaxed),
+      counters.numDeallocations.load(std::memory_order_relaxed),
+      counters.numBytesAllocated.load(std::memory_order_relaxed),
+      counters.numLiveBytes.load(std::memory_order_relaxed),
+      counters.peakNumLiveBytes.load(std::memory_order_relaxed)
+    };
+  }
+
+  bool isAllocationTrackingEnabled()
+  {
+#ifdef COREX_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  void* allocateTracked(size_t size, size_t alignment)
+  {
+    const size_t padding = (alignment > _minHeaderPadding) ? alignment
+                                                           : _minHeaderPadding;
+    char* rawPtr = static_cast<char*>(allocateAligned(size + padding,
+                                                      padding));
+    if (rawPtr == nullptr) {
+      return nullptr;
+    }
+
+    char* userPtr = rawPtr + padding;
+    const int32_t tag = _currAllocationTag;
+    auto* header = reinterpret_cast<AllocationHeader*>(
+      userPtr - sizeof(AllocationHeader));
+    *header = AllocationHeader{
+      size,
+      static_cast<uint32_t>(tag),
+      static_cast<uint32_t>(padding)
+    };
+
+    AllocationCounters& counters = _allocationCounters[tag];
+    counters.numAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.numBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    int64_t numLiveBytes = counters.numLiveBytes.fetch_add(
+      size, std::memory_order_relaxed) + size;
+    int64_t peakNumLiveBytes = counters.peakNumLiveBytes.load(
+      std::memory_order_relaxed);
+    while (numLiveBytes > peakNumLiveBytes
+           && !counters.peakNumLiveBytes.compare_exchange_weak(
+                 peakNumLiveBytes, numLiveBytes, std::memory_order_relaxed)) {}
+
+    return userPtr;
+  }
+
+  void freeTracked(void* ptr)
+  {
+    if (ptr == nullptr) {
+      return;
+    }
+
+    char* userPtr = static_cast<char*>(ptr);
+    const AllocationHeader header = *reinterpret_cast<AllocationHeader*>(
+      userPtr - sizeof(AllocationHeader));
+
+    AllocationCounters& counters = _allocationCounters[header.tag];
+    counters.numDeallocations.fetch_add(1, std::memory_order_relaxed);
+    counters.numLiveBytes.fetch_sub(header.size, std::memory_order_relaxed);
+
+    freeAligned(userPtr - header.offset);
+  }
+
+  AllocationScope::AllocationScope(int32_t tag)
+    : prevTag(_currAllocationTag)
+  {
+    _currAllocationTag = tag;
+  }
+
+  AllocationScope::~AllocationScope()
+  {
+    _currAllocationTag = this->prevTag;
+  }
+}
+
+#ifdef COREX_TRACK_ALLOCATIONS
+// Every allocation must go through allocateTracked(), and every deallocation
+// must go through freeTracked(), since freeTracked() expects the header that
+// allocateTracked() adds. The EASTL allocation hooks in allocator.cpp do the
+// same when allocation tracking is on.
+void* operator new(size_t size)
+{
+  void* ptr = corex::core::allocateTracked(size, alignof(max_align_t));
+  if (ptr == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return ptr;
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+  return corex::core::allocateTracked(size, alignof(max_align_t));
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+  return corex::core::allocateTracked(size, alignof(max_align_t));
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+  void* ptr = corex::core::allocateTracked(size,
+                                           static_cast<size_t>(alignment));
+  if (ptr == nullptr) {
+    throw std::bad_alloc{};
+  }
+
+  return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+  return operator new(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete(void* ptr, size_t size) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete[](void* ptr, size_t size) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete(void* ptr,
+                     size_t size,
+                     std::align_val_t alignment) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+
+void operator delete[](void* ptr,
+                       size_t size,
+                       std::align_val_t alignment) noexcept
+{
+  corex::core::freeTracked(ptr);
+}
+#endif
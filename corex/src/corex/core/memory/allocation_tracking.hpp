@@ -0,0 +1,82 @@
+#ifndef COREX_CORE_MEMORY_ALLOCATION_TRACKING_HPP
+#define COREX_CORE_MEMORY_ALLOCATION_TRACKING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Allocation tracking is only available when building with
+// COREX_TRACK_ALLOCATIONS turned on (-DCOREX_TRACK_ALLOCATIONS=ON). When it is
+// on, the global new and delete operators, and the EASTL allocation hooks, keep
+// count of the allocations made under each allocation tag. Use
+// COREX_ALLOCATION_SCOPE() to tag the allocations made within a scope, e.g.:
+//
+//   void Foo::update()
+//   {
+//     COREX_ALLOCATION_SCOPE("Foo Update");
+//     ...
+//   }
+//
+// Allocations made outside any scope go to the "Untagged" tag. Deallocations
+// are counted under the tag the memory was allocated with.
+#ifdef COREX_TRACK_ALLOCATIONS
+#define COREX_ALLOCATION_SCOPE_CONCAT_IMPL(a, b) a##b
+#define COREX_ALLOCATION_SCOPE_CONCAT(a, b) \
+  COREX_ALLOCATION_SCOPE_CONCAT_IMPL(a, b)
+#define COREX_ALLOCATION_SCOPE(tagName)                                       \
+  static const int32_t COREX_ALLOCATION_SCOPE_CONCAT(_allocTag, __LINE__) =  \
+    corex::core::registerAllocationTag(tagName);                              \
+  corex::core::AllocationScope COREX_ALLOCATION_SCOPE_CONCAT(_allocScope,     \
+                                                             __LINE__){       \
+    COREX_ALLOCATION_SCOPE_CONCAT(_allocTag, __LINE__)                        \
+  }
+#else
+#define COREX_ALLOCATION_SCOPE(tagName) do {} while (0)
+#endif
+
+namespace corex::core
+{
+  constexpr int32_t maxNumAllocationTags = 16;
+  constexpr int32_t untaggedAllocationTag = 0;
+
+  struct AllocationStats
+  {
+    uint64_t numAllocations;
+    uint64_t numDeallocations;
+    uint64_t numBytesAllocated;
+    int64_t numLiveBytes;
+    int64_t peakNumLiveBytes;
+  };
+
+  // Tag names must outlive the program (string literals are fine). If all
+  // tags have been used up, the untagged tag is returned.
+  int32_t registerAllocationTag(const char* name);
+  int32_t getNumAllocationTags();
+  const char* getAllocationTagName(int32_t tag);
+  AllocationStats getAllocationStats(int32_t tag);
+  bool isAllocationTrackingEnabled();
+
+  void* allocateTracked(size_t size, size_t alignment);
+  void freeTracked(void* ptr);
+
+  // Sets the allocation tag of the current thread until the scope ends.
+  class AllocationScope
+  {
+  public:
+    explicit AllocationScope(int32_t tag);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+  private:
+    int32_t prevTag;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
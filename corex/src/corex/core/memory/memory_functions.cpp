@@ -0,0 +1,38 @@
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+
+#include <corex/core/memory/LinearArena.hpp>
+#include <corex/core/memory/memory_functions.hpp>
+
+namespace corex::core
+{
+  void* allocateAligned(size_t size, size_t alignment)
+  {
+    // Alignments must be a power of two.
+    assert((alignment & (alignment - 1)) == 0);
+
+    if (alignment <= alignof(max_align_t)) {
+      // malloc() already gives us this alignment.
+      return malloc(size);
+    }
+
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+      return nullptr;
+    }
+
+    return ptr;
+  }
+
+  void freeAligned(void* ptr)
+  {
+    free(ptr);
+  }
+
+  LinearArena& getFrameArena()
+  {
+    static LinearArena frameArena{ 256 * 1024, "Frame Arena" };
+    return frameArena;
+  }
+}
@@ -0,0 +1,26 @@
+#ifndef COREX_CORE_MEMORY_MEMORY_FUNCTIONS_HPP
+#define COREX_CORE_MEMORY_MEMORY_FUNCTIONS_HPP
+
+#include <cstddef>
+
+#include <corex/core/memory/LinearArena.hpp>
+
+namespace corex::core
+{
+  // Memory allocated with allocateAligned() can be freed with freeAligned() or
+  // free(), since it comes from posix_memalign().
+  void* allocateAligned(size_t size, size_t alignment);
+  void freeAligned(void* ptr);
+
+  // The frame arena is reset at the start of every frame by Application. Only
+  // use it for data that does not need to outlive the frame, and only from the
+  // main thread.
+  LinearArena& getFrameArena();
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
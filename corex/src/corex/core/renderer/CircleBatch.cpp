@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include <EASTL/vector.h>
+#include <SDL2/SDL.h>
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/CircleBatch.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  int32_t _computeNumCircleSegments(float radius)
+  {
+    // Same heuristic SDL_gpu uses for its own circles, where bigger circles
+    // get more segments.
+    const float angleStep = 1.25f / std::sqrt(std::max(radius, 1.f));
+    const float fullAngle = 2.f * static_cast<float>(pi);
+    return static_cast<int32_t>(std::ceil(fullAngle / angleStep));
+  }
+  /////////////////////////////////////////////////
+
+  CircleBatch::CircleBatch()
+    : commandList(nullptr)
+    , unitCircles()
+    , vertexValues()
+    , indexes()
+    , numVertices(0)
+    , numDrawCalls(0) {}
+
+  void CircleBatch::begin(RenderCommandList& commandList)
+  {
+    this->commandList = &commandList;
+    this->vertexValues.clear();
+    this->indexes.clear();
+    this->numVertices = 0;
+    this->numDrawCalls = 0;
+  }
+
+  void CircleBatch::add(float x, float y, float radius, SDL_Color colour)
+  {
+    const int32_t numSegments = std::clamp(_computeNumCircleSegments(radius),
+                                           kMinNumSegments,
+                                           kMaxNumSegments);
+    const int32_t numCircleVertices = numSegments + 1;
+    if (this->numVertices + numCircleVertices > kMaxNumVertices) {
+      this->flush();
+    }
+
+    const eastl::vector<Point>& unitCircle = this->getUnitCircle(numSegments);
+    const float r = colour.r / 255.f;
+    const float g = colour.g / 255.f;
+    const float b = colour.b / 255.f;
+    const float a = colour.a / 255.f;
+
+    // The center vertex goes first, followed by the vertices in the rim.
+    const auto centerIndex = static_cast<unsigned short>(this->numVertices);
+    this->vertexValues.insert(this->vertexValues.end(), { x, y, r, g, b, a });
+    for (const Point& pt : unitCircle) {
+      this->vertexValues.insert(
+        this->vertexValues.end(),
+        { x + (pt.x * radius), y + (pt.y * radius), r, g, b, a }
+      );
+    }
+
+    for (int32_t i = 0; i < numSegments; i++) {
+      const int32_t nextI = (i + 1) % numSegments;
+      this->indexes.push_back(centerIndex);
+      this->indexes.push_back(static_cast<unsigned short>(centerIndex + 1 + i));
+      this->indexes.push_back(
+        static_cast<unsigned short>(centerIndex + 1 + nextI));
+    }
+
+    this->numVertices += numCircleVertices;
+  }
+
+  void CircleBatch::flush()
+  {
+    if (this->numVertices == 0) {
+      return;
+    }
+
+    this->commandList->addTriangles(this->vertexValues.data(),
+                                    this->numVertices,
+                                    this->indexes.data(),
+                                    this->indexes.size());
+
+    this->vertexValues.clear();
+    this->indexes.clear();
+    this->numVertices = 0;
+    this->numDrawCalls++;
+  }
+
+  int32_t CircleBatch::getNumDrawCalls() const
+  {
+    return this->numDrawCalls;
+  }
+
+  const eastl::vector<Point>& CircleBatch::getUnitCircle(int32_t numSegments)
+  {
+    eastl::vector<Point>& unitCircle = this->unitCircles[numSegments];
+    if (unitCircle.empty()) {
+      unitCircle.reserve(numSegments);
+      const float angleStep = (2.f * static_cast<float>(pi)) / numSegments;
+      for (int32_t i = 0; i < numSegments; i++) {
+        const float angle = angleStep * i;
+        unitCircle.push_back(Point{ std::cos(angle), std::sin(angle) });
+      }
+    }
+
+    return unitCircle;
+  }
+}
@@ -0,0 +1,60 @@
+#ifndef COREX_CORE_RENDERER_CIRCLE_BATCH_HPP
+#define COREX_CORE_RENDERER_CIRCLE_BATCH_HPP
+
+#include <cstdint>
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+#include <SDL2/SDL.h>
+
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Collects filled circles into a single vertex buffer so that they can be
+  // recorded as one TRIANGLES command, which is drawn with one
+  // GPU_TriangleBatch() call, instead of one GPU_CircleFilled() call each.
+  // Every circle is a triangle fan built from a unit circle that is
+  // tessellated once per segment count and shared by all circles with that
+  // segment count.
+  //
+  // Circles are drawn in the order they were added. Callers that mix circles
+  // with other commands must flush the batch before recording anything else
+  // to keep the draw order.
+  class CircleBatch
+  {
+  public:
+    CircleBatch();
+
+    void begin(RenderCommandList& commandList);
+    void add(float x, float y, float radius, SDL_Color colour);
+    void flush();
+
+    int32_t getNumDrawCalls() const;
+
+  private:
+    static constexpr int32_t kMinNumSegments = 12;
+    static constexpr int32_t kMaxNumSegments = 64;
+
+    // Indexes passed to GPU_TriangleBatch() are unsigned shorts, so a single
+    // draw call can't have more vertices than this.
+    static constexpr int32_t kMaxNumVertices = 65535;
+
+    RenderCommandList* commandList;
+    eastl::array<eastl::vector<Point>, kMaxNumSegments + 1> unitCircles;
+    eastl::vector<float> vertexValues; // x, y, r, g, b, a per vertex.
+    eastl::vector<unsigned short> indexes;
+    int32_t numVertices;
+    int32_t numDrawCalls;
+
+    const eastl::vector<Point>& getUnitCircle(int32_t numSegments);
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
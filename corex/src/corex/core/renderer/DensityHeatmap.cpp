@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COREX_DENSITY_HEATMAP_USE_SSE2
+#endif
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/vector.h>
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/sdl_deleters.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/DensityHeatmap.hpp>
+#include <corex/core/renderer/GPUContextLock.hpp>
+#include <corex/core/renderer/ImageUpdateQueue.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  static_assert(sizeof(Point) == sizeof(float) * 2,
+                "Binning assumes that points are packed x, y pairs.");
+
+  constexpr int32_t _numChannels = 4;
+
+  // Colours of the least and most dense cells, and of the cells halfway.
+  constexpr SDL_Color _lowDensityColour{ 10, 41, 79, 255 };
+  constexpr SDL_Color _midDensityColour{ 196, 69, 54, 255 };
+  constexpr SDL_Color _highDensityColour{ 255, 224, 102, 255 };
+
+  // Returns the index of the point's cell, or -1 if it's outside of the
+  // bounds. Points on the far edges of the bounds go into the last column or
+  // row.
+  int32_t _getCellIndex(const Point& point,
+                        const AABB& bounds,
+                        float columnsPerUnit,
+                        float rowsPerUnit,
+                        int32_t numColumns,
+                        int32_t numRows)
+  {
+    // Written so that NaNs end up outside of the bounds.
+    if (!(point.x >= bounds.minPt.x && point.x <= bounds.maxPt.x
+          && point.y >= bounds.minPt.y && point.y <= bounds.maxPt.y)) {
+      return -1;
+    }
+
+    const int32_t column = std::min(
+      static_cast<int32_t>((point.x - bounds.minPt.x) * columnsPerUnit),
+      numColumns - 1);
+    const int32_t row = std::min(
+      static_cast<int32_t>((point.y - bounds.minPt.y) * rowsPerUnit),
+      numRows - 1);
+    return (row * numColumns) + column;
+  }
+
+  void _binPointsScalar(const Point* points,
+                        int32_t numPoints,
+                        const AABB& bounds,
+                        float columnsPerUnit,
+                        float rowsPerUnit,
+                        int32_t numColumns,
+                        int32_t numRows,
+                        uint32_t* counts)
+  {
+    for (int32_t i = 0; i < numPoints; i++) {
+      const int32_t cellIndex = _getCellIndex(points[i],
+                                              bounds,
+                                              columnsPerUnit,
+                                              rowsPerUnit,
+                                              numColumns,
+                                              numRows);
+      if (cellIndex >= 0) {
+        counts[cellIndex]++;
+      }
+    }
+  }
+
+#ifdef COREX_DENSITY_HEATMAP_USE_SSE2
+  // Computes the cells of four points at a time. The counts themselves still
+  // get incremented one at a time, since points in the same batch can land in
+  // the same cell.
+  int32_t _binPointsSSE2(const Point* points,
+                         int32_t numPoints,
+                         const AABB& bounds,
+                         float columnsPerUnit,
+                         float rowsPerUnit,
+                         int32_t numColumns,
+                         int32_t numRows,
+                         uint32_t* counts)
+  {
+    const __m128 minXs = _mm_set1_ps(bounds.minPt.x);
+    const __m128 minYs = _mm_set1_ps(bounds.minPt.y);
+    const __m128 maxXs = _mm_set1_ps(bounds.maxPt.x);
+    const __m128 maxYs = _mm_set1_ps(bounds.maxPt.y);
+    const __m128 columnsPerUnits = _mm_set1_ps(columnsPerUnit);
+    const __m128 rowsPerUnits = _mm_set1_ps(rowsPerUnit);
+    const __m128 numColumnsPs = _mm_set1_ps(static_cast<float>(numColumns));
+    const __m128 lastColumns = _mm_set1_ps(static_cast<float>(numColumns - 1));
+    const __m128 lastRows = _mm_set1_ps(static_cast<float>(numRows - 1));
+
+    alignas(16) int32_t cellIndexes[4];
+    const int32_t numBatchedPoints = numPoints - (numPoints % 4);
+    for (int32_t i = 0; i < numBatchedPoints; i += 4) {
+      const float* values = reinterpret_cast<const float*>(points + i);
+      const __m128 firstPair = _mm_loadu_ps(values);
+      const __m128 secondPair = _mm_loadu_ps(values + 4);
+      const __m128 xs = _mm_shuffle_ps(firstPair,
+                                       secondPair,
+                                       _MM_SHUFFLE(2, 0, 2, 0));
+      const __m128 ys = _mm_shuffle_ps(firstPair,
+                                       secondPair,
+                                       _MM_SHUFFLE(3, 1, 3, 1));
+
+      // Comparisons with NaNs are false, so NaNs get masked out too.
+      const __m128 isInBounds = _mm_and_ps(
+        _mm_and_ps(_mm_cmpge_ps(xs, minXs), _mm_cmple_ps(xs, maxXs)),
+        _mm_and_ps(_mm_cmpge_ps(ys, minYs), _mm_cmple_ps(ys, maxYs)));
+      const int32_t inBoundsMask = _mm_movemask_ps(isInBounds);
+      if (inBoundsMask == 0) {
+        continue;
+      }
+
+      // SSE2 has no 32-bit integer multiply, so the index is computed with
+      // floats. It's exact as long as the grid has fewer than 2^24 cells.
+      const __m128 cellXs = _mm_mul_ps(_mm_sub_ps(xs, minXs),
+                                       columnsPerUnits);
+      const __m128 cellYs = _mm_mul_ps(_mm_sub_ps(ys, minYs), rowsPerUnits);
+      const __m128 columns = _mm_min_ps(
+        _mm_cvtepi32_ps(_mm_cvttps_epi32(cellXs)), lastColumns);
+      const __m128 rows = _mm_min_ps(
+        _mm_cvtepi32_ps(_mm_cvttps_epi32(cellYs)), lastRows);
+      const __m128i indexes = _mm_cvttps_epi32(
+        _mm_add_ps(_mm_mul_ps(rows, numColumnsPs), columns));
+      _mm_store_si128(reinterpret_cast<__m128i*>(cellIndexes), indexes);
+
+      for (int32_t j = 0; j < 4; j++) {
+        if (inBoundsMask & (1 << j)) {
+          counts[cellIndexes[j]]++;
+        }
+      }
+    }
+
+    return numBatchedPoints;
+  }
+#endif
+
+  Uint8 _lerpChannel(Uint8 a, Uint8 b, float t)
+  {
+    return static_cast<Uint8>(a + ((b - a) * t));
+  }
+
+  SDL_Color _getDensityColour(float t)
+  {
+    const SDL_Color& fromColour = (t < 0.5f) ? _lowDensityColour
+                                             : _midDensityColour;
+    const SDL_Color& toColour = (t < 0.5f) ? _midDensityColour
+                                           : _highDensityColour;
+    const float localT = (t < 0.5f) ? (t * 2.f) : ((t - 0.5f) * 2.f);
+    return SDL_Color{ _lerpChannel(fromColour.r, toColour.r, localT),
+                      _lerpChannel(fromColour.g, toColour.g, localT),
+                      _lerpChannel(fromColour.b, toColour.b, localT),
+                      255 };
+  }
+  /////////////////////////////////////////////////
+
+  DensityHeatmap::DensityHeatmap(int32_t numColumns, int32_t numRows)
+    : numColumns(std::max(numColumns, 1))
+    , numRows(std::max(numRows, 1))
+    , counts(this->numColumns * this->numRows, 0)
+    , pixels(this->numColumns * this->numRows * _numChannels, 0)
+    , texture(nullptr)
+    , maxCount(0) {}
+
+  void DensityHeatmap::bin(const Point* points,
+                           int32_t numPoints,
+                           const AABB& bounds)
+  {
+    std::fill(this->counts.begin(), this->counts.end(), 0);
+    this->maxCount = 0;
+
+    const float width = bounds.maxPt.x - bounds.minPt.x;
+    const float height = bounds.maxPt.y - bounds.minPt.y;
+    if (width <= 0.f || height <= 0.f || numPoints <= 0) {
+      return;
+    }
+
+    const float columnsPerUnit = this->numColumns / width;
+    const float rowsPerUnit = this->numRows / height;
+
+    int32_t numBinnedPoints = 0;
+#ifdef COREX_DENSITY_HEATMAP_USE_SSE2
+    numBinnedPoints = _binPointsSSE2(points,
+                                     numPoints,
+                                     bounds,
+                                     columnsPerUnit,
+                                     rowsPerUnit,
+                                     this->numColumns,
+                                     this->numRows,
+                                     this->counts.data());
+#endif
+
+    // Whatever the SIMD path didn't get to.
+    _binPointsScalar(points + numBinnedPoints,
+                     numPoints - numBinnedPoints,
+                     bounds,
+                     columnsPerUnit,
+                     rowsPerUnit,
+                     this->numColumns,
+                     this->numRows,
+                     this->counts.data());
+
+    this->maxCount = *std::max_element(this->counts.begin(),
+                                       this->counts.end());
+  }
+
+  void DensityHeatmap::updateTexture()
+  {
+    const float logMaxCount = std::log1p(static_cast<float>(this->maxCount));
+    for (size_t i = 0; i < this->counts.size(); i++) {
+      uint8_t* pixel = this->pixels.data() + (i * _numChannels);
+      if (this->counts[i] == 0) {
+        pixel[0] = 0;
+        pixel[1] = 0;
+        pixel[2] = 0;
+        pixel[3] = 0;
+        continue;
+      }
+
+      // A single non-empty cell has a log max count of log(2), not zero.
+      const float t = std::log1p(static_cast<float>(this->counts[i]))
+                      / logMaxCount;
+      const SDL_Color colour = _getDensityColour(std::min(t, 1.f));
+      pixel[0] = colour.r;
+      pixel[1] = colour.g;
+      pixel[2] = colour.b;
+      pixel[3] = colour.a;
+    }
+
+    if (!this->texture) {
+      GPUContextLock contextLock;
+      GPU_Image* image = GPU_CreateImage(this->numColumns,
+                                         this->numRows,
+                                         GPU_FORMAT_RGBA);
+      if (image == nullptr) {
+        return;
+      }
+
+      // Keep the cells crisp when the heatmap is stretched.
+      GPU_SetImageFilter(image, GPU_FILTER_NEAREST);
+      this->texture = eastl::shared_ptr<GPU_Image>(image,
+                                                   SDLGPUImageDeleter());
+    }
+
+    // This gets called every frame during playback, so the upload goes
+    // through the next frame's commands instead of taking the GPU context.
+    getImageUpdateQueue().add(this->texture,
+                              this->pixels.data(),
+                              this->numColumns * _numChannels);
+  }
+
+  eastl::shared_ptr<GPU_Image> DensityHeatmap::getTexture() const
+  {
+    return this->texture;
+  }
+
+  const eastl::vector<uint32_t>& DensityHeatmap::getCounts() const
+  {
+    return this->counts;
+  }
+
+  uint32_t DensityHeatmap::getMaxCount() const
+  {
+    return this->maxCount;
+  }
+
+  int32_t DensityHeatmap::getNumColumns() const
+  {
+    return this->numColumns;
+  }
+
+  int32_t DensityHeatmap::getNumRows() const
+  {
+    return this->numRows;
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef COREX_CORE_RENDERER_DENSITY_HEATMAP_HPP
+#define COREX_CORE_RENDERER_DENSITY_HEATMAP_HPP
+
+#include <cstdint>
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/vector.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+
+namespace corex::core
+{
+  // Shows how many points are in each cell of a grid, as a texture with one
+  // pixel per cell. Meant for when there are too many points to draw each of
+  // them. Binning is done with SSE2 when it's available.
+  //
+  // Cells are coloured on a log scale, so that sparse cells don't fade away
+  // next to dense ones. Empty cells are transparent. Row 0 of the texture is
+  // at the top of the bounds.
+  class DensityHeatmap
+  {
+  public:
+    DensityHeatmap(int32_t numColumns, int32_t numRows);
+
+    // Counts the points in each cell of the bounds, replacing the previous
+    // counts. Points outside of the bounds, and NaN points, are ignored.
+    // Points on the maximum edges of the bounds go into the last column or
+    // row.
+    void bin(const Point* points, int32_t numPoints, const AABB& bounds);
+
+    // Queues an upload of the current counts to the texture, creating it if
+    // needed. The texture shows the new counts from the next frame on.
+    void updateTexture();
+
+    eastl::shared_ptr<GPU_Image> getTexture() const;
+    const eastl::vector<uint32_t>& getCounts() const;
+    uint32_t getMaxCount() const;
+    int32_t getNumColumns() const;
+    int32_t getNumRows() const;
+
+  private:
+    int32_t numColumns;
+    int32_t numRows;
+    eastl::vector<uint32_t> counts;
+    eastl::vector<uint8_t> pixels; // RGBA, one pixel per cell.
+    eastl::shared_ptr<GPU_Image> texture;
+    uint32_t maxCount;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,353 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <GL/glew.h>
+
+#include <corex/core/utils.hpp>
+#include <corex/core/renderer/FrameCapture.hpp>
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
+#include <corex/core/renderer/PNGWriter.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  constexpr int32_t _numBytesPerPixel = 4;
+  constexpr int32_t _maxNumWorkers = 4;
+
+  // Enough to ride out hiccups in disk writes without holding on to too many
+  // frames. A 1080p frame is about 8 MB.
+  constexpr int32_t _maxNumQueuedJobs = 32;
+
+  constexpr GLuint64 _fenceWaitTimeout = 1000000000; // In nanoseconds.
+
+  // Writes the pixels as a PAM file, flipping them since they come from
+  // glReadPixels() bottom row first.
+  bool _writePAMFile(const eastl::string& filePath,
+                     const uint8_t* pixels,
+                     int32_t width,
+                     int32_t height)
+  {
+    FILE* file = std::fopen(filePath.c_str(), "wb");
+    if (file == nullptr) {
+      return false;
+    }
+
+    bool isWriteSuccessful = std::fprintf(file,
+                                          "P7\nWIDTH %d\nHEIGHT %d\nDEPTH 4\n"
+                                          "MAXVAL 255\nTUPLTYPE RGB_ALPHA\n"
+                                          "ENDHDR\n",
+                                          width,
+                                          height) > 0;
+
+    const size_t rowSize = static_cast<size_t>(width) * _numBytesPerPixel;
+    for (int32_t y = height - 1; y >= 0 && isWriteSuccessful; y--) {
+      const uint8_t* row = pixels + (static_cast<size_t>(y) * rowSize);
+      isWriteSuccessful = std::fwrite(row, 1, rowSize, file) == rowSize;
+    }
+
+    return (std::fclose(file) == 0) && isWriteSuccessful;
+  }
+  /////////////////////////////////////////////////
+
+  FrameCapture::FrameCapture()
+    : readbacks()
+    , currReadbackIndex(0)
+    , outputFolder()
+    , format(FrameCaptureFormat::PNG)
+    , isCaptureActive(false)
+    , numCapturedFrames(0)
+    , numWrittenFrames(0)
+    , workers()
+    , jobMutex()
+    , jobAvailableCondition()
+    , jobSlotAvailableCondition()
+    , jobs()
+    , freePixelBuffers()
+    , areWorkersStopping(false) {}
+
+  FrameCapture::~FrameCapture()
+  {
+    // The OpenGL context might be gone by now, so we only stop the workers
+    // here. Frames still in the PBOs are lost if stop() wasn't called.
+    this->stopWorkers();
+  }
+
+  bool FrameCapture::start(const eastl::string& outputFolder,
+                           FrameCaptureFormat format)
+  {
+    if (this->isCaptureActive) {
+      this->stop();
+    }
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(eaStrToStdStr(outputFolder),
+                                        errorCode);
+    if (errorCode) {
+      std::cout << "Unable to create the frame capture folder, "
+                << eaStrToStdStr(outputFolder) << ": "
+                << errorCode.message() << std::endl;
+      return false;
+    }
+
+    this->outputFolder = outputFolder;
+    this->format = format;
+    this->currReadbackIndex = 0;
+    this->numCapturedFrames = 0;
+    this->numWrittenFrames = 0;
+
+    for (Readback& readback : this->readbacks) {
+      readback = Readback{ 0, nullptr, 0, 0, 0, 0, false };
+      glGenBuffers(1, &readback.pbo);
+    }
+
+    // Leave a core for the render loop.
+    const int32_t numHardwareThreads = std::thread::hardware_concurrency();
+    const int32_t numWorkers = std::clamp(numHardwareThreads - 1,
+                                          1,
+                                          _maxNumWorkers);
+    this->areWorkersStopping = false;
+    for (int32_t i = 0; i < numWorkers; i++) {
+      this->workers.emplace_back(&FrameCapture::runWorker, this);
+    }
+
+    this->isCaptureActive = true;
+
+    std::cout << "Capturing frames to " << eaStrToStdStr(outputFolder)
+              << " using " << numWorkers << " worker(s)." << std::endl;
+
+    return true;
+  }
+
+  void FrameCapture::stop()
+  {
+    if (!this->isCaptureActive) {
+      return;
+    }
+
+    // Collect the pending readbacks from oldest to newest, so that frames
+    // are queued in order.
+    for (int32_t i = 0; i < numReadbacks; i++) {
+      const int32_t index = (this->currReadbackIndex + i) % numReadbacks;
+      Readback& readback = this->readbacks[index];
+      if (readback.isPending) {
+        this->collectReadback(readback);
+      }
+
+      glDeleteBuffers(1, &readback.pbo);
+      readback.pbo = 0;
+    }
+
+    this->stopWorkers();
+    this->isCaptureActive = false;
+
+    std::cout << "Finished capturing " << this->numWrittenFrames << " of "
+              << this->numCapturedFrames << " frame(s) to "
+              << eaStrToStdStr(this->outputFolder) << "." << std::endl;
+  }
+
+  bool FrameCapture::isCapturing() const
+  {
+    return this->isCaptureActive;
+  }
+
+  void FrameCapture::captureFrame(int32_t width, int32_t height)
+  {
+    if (!this->isCaptureActive || width <= 0 || height <= 0) {
+      return;
+    }
+
+    // The readback in this slot was issued numReadbacks frames ago, so it
+    // should be done by now, and collecting it shouldn't block.
+    Readback& readback = this->readbacks[this->currReadbackIndex];
+    if (readback.isPending) {
+      this->collectReadback(readback);
+    }
+
+    const int32_t bufferSize = width * height * _numBytesPerPixel;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+    if (readback.bufferSize != bufferSize) {
+      glBufferData(GL_PIXEL_PACK_BUFFER, bufferSize, nullptr, GL_STREAM_READ);
+      readback.bufferSize = bufferSize;
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback.frameIndex = this->numCapturedFrames;
+    readback.width = width;
+    readback.height = height;
+    readback.isPending = true;
+
+    this->currReadbackIndex = (this->currReadbackIndex + 1) % numReadbacks;
+    this->numCapturedFrames++;
+  }
+
+  int32_t FrameCapture::getNumCapturedFrames() const
+  {
+    return this->numCapturedFrames;
+  }
+
+  int32_t FrameCapture::getNumWrittenFrames() const
+  {
+    return this->numWrittenFrames;
+  }
+
+  void FrameCapture::collectReadback(Readback& readback)
+  {
+    GLenum waitStatus = GL_TIMEOUT_EXPIRED;
+    while (waitStatus == GL_TIMEOUT_EXPIRED) {
+      waitStatus = glClientWaitSync(readback.fence,
+                                    GL_SYNC_FLUSH_COMMANDS_BIT,
+                                    _fenceWaitTimeout);
+    }
+
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+    readback.isPending = false;
+
+    if (waitStatus == GL_WAIT_FAILED) {
+      std::cout << "Failed waiting for frame " << readback.frameIndex
+                << " to be read back. Skipping it." << std::endl;
+      return;
+    }
+
+    Job job;
+    job.frameIndex = readback.frameIndex;
+    job.width = readback.width;
+    job.height = readback.height;
+    {
+      std::lock_guard<std::mutex> lock(this->jobMutex);
+      if (!this->freePixelBuffers.empty()) {
+        job.pixels = eastl::move(this->freePixelBuffers.back());
+        this->freePixelBuffers.pop_back();
+      }
+    }
+
+    job.pixels.resize(readback.bufferSize);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+    const void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER,
+                                          0,
+                                          readback.bufferSize,
+                                          GL_MAP_READ_BIT);
+    if (pixels == nullptr) {
+      glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+      std::cout << "Failed to map the pixels of frame " << readback.frameIndex
+                << ". Skipping it." << std::endl;
+      return;
+    }
+
+    std::memcpy(job.pixels.data(), pixels, readback.bufferSize);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    this->queueJob(eastl::move(job));
+  }
+
+  void FrameCapture::queueJob(Job&& job)
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->jobMutex);
+      this->jobSlotAvailableCondition.wait(lock, [this]() {
+        return this->jobs.size() < _maxNumQueuedJobs;
+      });
+
+      this->jobs.push_back(eastl::move(job));
+    }
+
+    this->jobAvailableCondition.notify_one();
+  }
+
+  void FrameCapture::stopWorkers()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->jobMutex);
+      this->areWorkersStopping = true;
+    }
+
+    // Workers finish the jobs left in the queue before they stop.
+    this->jobAvailableCondition.notify_all();
+    for (std::thread& worker : this->workers) {
+      worker.join();
+    }
+
+    this->workers.clear();
+  }
+
+  void FrameCapture::runWorker()
+  {
+    PNGWriter pngWriter;
+    while (true) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(this->jobMutex);
+        this->jobAvailableCondition.wait(lock, [this]() {
+          return !this->jobs.empty() || this->areWorkersStopping;
+        });
+
+        if (this->jobs.empty()) {
+          return;
+        }
+
+        job = eastl::move(this->jobs.front());
+        this->jobs.pop_front();
+      }
+
+      this->jobSlotAvailableCondition.notify_one();
+
+      if (this->writeFrame(job, pngWriter)) {
+        this->numWrittenFrames++;
+      } else {
+        std::cout << "Failed to write frame " << job.frameIndex << "."
+                  << std::endl;
+      }
+
+      std::lock_guard<std::mutex> lock(this->jobMutex);
+      this->freePixelBuffers.push_back(eastl::move(job.pixels));
+    }
+  }
+
+  bool FrameCapture::writeFrame(const Job& job, PNGWriter& pngWriter) const
+  {
+    const char* extension = (this->format == FrameCaptureFormat::PNG)
+                            ? "png"
+                            : "pam";
+    char fileName[32];
+    std::snprintf(fileName,
+                  sizeof(fileName),
+                  "frame_%06d.%s",
+                  job.frameIndex,
+                  extension);
+
+    const eastl::string filePath = stdStrToEAStr(
+      (std::filesystem::path(eaStrToStdStr(this->outputFolder)) / fileName)
+        .string());
+
+    switch (this->format) {
+      case FrameCaptureFormat::PNG:
+        return pngWriter.write(filePath,
+                               job.pixels.data(),
+                               job.width,
+                               job.height,
+                               true);
+      case FrameCaptureFormat::RAW:
+        return _writePAMFile(filePath,
+                             job.pixels.data(),
+                             job.width,
+                             job.height);
+    }
+
+    return false;
+  }
+}
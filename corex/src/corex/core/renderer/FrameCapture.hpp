@@ -0,0 +1,109 @@
+#ifndef COREX_CORE_RENDERER_FRAME_CAPTURE_HPP
+#define COREX_CORE_RENDERER_FRAME_CAPTURE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <EASTL/array.h>
+#include <EASTL/deque.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <GL/glew.h>
+
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
+#include <corex/core/renderer/PNGWriter.hpp>
+
+namespace corex::core
+{
+  // Captures rendered frames into numbered image files (frame_000000.png,
+  // frame_000001.png, and so on) without stalling the render loop.
+  //
+  // Each frame gets read back into a pixel buffer object (PBO) from a small
+  // ring. glReadPixels() into a PBO returns right away, and the copy happens
+  // on the GPU. The PBO is only mapped when its slot in the ring is about to
+  // be reused, which is a few frames later, by which point the copy is done.
+  // The mapped pixels get copied into a pooled buffer and handed off to a pool
+  // of worker threads that encode and write the frames to disk.
+  //
+  // The job queue is bounded. If the disk can't keep up, the render loop
+  // waits for a slot in the queue instead of piling up frames in memory.
+  //
+  // Everything except the worker threads must be called from the thread that
+  // owns the OpenGL context.
+  class FrameCapture
+  {
+  public:
+    FrameCapture();
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    bool start(const eastl::string& outputFolder, FrameCaptureFormat format);
+
+    // Waits for all captured frames to be written.
+    void stop();
+
+    bool isCapturing() const;
+
+    // Reads back the bottom-left width x height pixels of the currently bound
+    // framebuffer. Anything drawn after this call won't be in the frame.
+    void captureFrame(int32_t width, int32_t height);
+    int32_t getNumCapturedFrames() const;
+    int32_t getNumWrittenFrames() const;
+
+  private:
+    static constexpr int32_t numReadbacks = 3;
+
+    struct Readback
+    {
+      GLuint pbo;
+      GLsync fence;
+      int32_t bufferSize;
+      int32_t frameIndex;
+      int32_t width;
+      int32_t height;
+      bool isPending;
+    };
+
+    struct Job
+    {
+      eastl::vector<uint8_t> pixels;
+      int32_t frameIndex;
+      int32_t width;
+      int32_t height;
+    };
+
+    eastl::array<Readback, numReadbacks> readbacks;
+    int32_t currReadbackIndex;
+    eastl::string outputFolder;
+    FrameCaptureFormat format;
+    bool isCaptureActive;
+    int32_t numCapturedFrames;
+    std::atomic<int32_t> numWrittenFrames;
+
+    eastl::vector<std::thread> workers;
+    std::mutex jobMutex;
+    std::condition_variable jobAvailableCondition;
+    std::condition_variable jobSlotAvailableCondition;
+    eastl::deque<Job> jobs;
+    eastl::vector<eastl::vector<uint8_t>> freePixelBuffers;
+    bool areWorkersStopping;
+
+    void collectReadback(Readback& readback);
+    void queueJob(Job&& job);
+    void stopWorkers();
+    void runWorker();
+    bool writeFrame(const Job& job, PNGWriter& pngWriter) const;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
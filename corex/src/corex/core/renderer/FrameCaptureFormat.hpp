@@ -0,0 +1,20 @@
+#ifndef COREX_CORE_RENDERER_FRAME_CAPTURE_FORMAT_HPP
+#define COREX_CORE_RENDERER_FRAME_CAPTURE_FORMAT_HPP
+
+namespace corex::core
+{
+  // PNG frames are compressed, and are what most video tools expect. RAW
+  // frames are stored uncompressed as PAM files (a Netpbm format), which are
+  // much faster to write, but are a lot bigger.
+  enum class FrameCaptureFormat
+  {
+    PNG, RAW
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,47 @@
+#include <cstdint>
+
+#include <corex/core/renderer/GPUContextLock.hpp>
+#include <corex/core/renderer/RenderThread.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  RenderThread* _activeRenderThread = nullptr;
+
+  // Only the outermost lock on a thread acquires and releases the context.
+  thread_local int32_t _numHeldLocks = 0;
+  /////////////////////////////////////////////////
+
+  GPUContextLock::GPUContextLock()
+    : isContextAcquired(false)
+  {
+    if (_activeRenderThread == nullptr
+        || _activeRenderThread->isCurrentThread()) {
+      return;
+    }
+
+    if (_numHeldLocks == 0) {
+      _activeRenderThread->acquireContext();
+    }
+
+    _numHeldLocks++;
+    this->isContextAcquired = true;
+  }
+
+  GPUContextLock::~GPUContextLock()
+  {
+    if (!this->isContextAcquired) {
+      return;
+    }
+
+    _numHeldLocks--;
+    if (_numHeldLocks == 0) {
+      _activeRenderThread->releaseContext();
+    }
+  }
+
+  void setActiveRenderThread(RenderThread* renderThread)
+  {
+    _activeRenderThread = renderThread;
+  }
+}
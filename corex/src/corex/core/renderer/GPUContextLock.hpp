@@ -0,0 +1,41 @@
+#ifndef COREX_CORE_RENDERER_GPU_CONTEXT_LOCK_HPP
+#define COREX_CORE_RENDERER_GPU_CONTEXT_LOCK_HPP
+
+#include <cstdint>
+
+namespace corex::core
+{
+  class RenderThread;
+
+  // Lets code outside the render thread use the OpenGL context, e.g. to create
+  // or free textures, while the render thread is running. Creating the lock
+  // waits for the render thread to finish every frame it has been given, and
+  // makes the context current on this thread until the lock is destroyed.
+  // Waiting for all frames also guarantees that no recorded frame still
+  // refers to a texture that is about to be freed.
+  //
+  // Does nothing if there is no render thread running, or if it's used from
+  // the render thread itself. Locks can be nested.
+  class GPUContextLock
+  {
+  public:
+    GPUContextLock();
+    ~GPUContextLock();
+
+    GPUContextLock(const GPUContextLock&) = delete;
+    GPUContextLock& operator=(const GPUContextLock&) = delete;
+
+  private:
+    bool isContextAcquired;
+  };
+
+  // Set by the render thread when it starts and stops.
+  void setActiveRenderThread(RenderThread* renderThread);
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
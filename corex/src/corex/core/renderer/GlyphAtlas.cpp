@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/sdl_deleters.hpp>
+#include <corex/core/asset_types/Font.hpp>
+#include <corex/core/renderer/GlyphAtlas.hpp>
+#include <corex/core/renderer/GPUContextLock.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  constexpr int32_t _numChannels = 4;
+
+  eastl::unordered_map<TTF_Font*, eastl::shared_ptr<GlyphAtlas>>&
+  _getGlyphAtlases()
+  {
+    static eastl::unordered_map<TTF_Font*,
+                                eastl::shared_ptr<GlyphAtlas>> atlases;
+    return atlases;
+  }
+  /////////////////////////////////////////////////
+
+  GlyphAtlas::GlyphAtlas(Font font)
+    : font(font)
+    , glyphs()
+    , pixels(kWidth * kInitialHeight * _numChannels, 0)
+    , image(nullptr)
+    , height(kInitialHeight)
+    , shelfX(0)
+    , shelfY(0)
+    , shelfHeight(0)
+  {
+    for (Glyph& glyph : this->glyphs) {
+      glyph = Glyph{ GPU_Rect{ 0.f, 0.f, 0.f, 0.f }, 0, false, false };
+    }
+  }
+
+  const GlyphAtlas::Glyph& GlyphAtlas::getGlyph(unsigned char character)
+  {
+    if (!this->glyphs[character].isLoaded) {
+      this->loadGlyph(character);
+    }
+
+    return this->glyphs[character];
+  }
+
+  int32_t GlyphAtlas::getKerning(unsigned char prevCharacter,
+                                 unsigned char character)
+  {
+    return TTF_GetFontKerningSizeGlyphs(this->font.get(),
+                                        prevCharacter,
+                                        character);
+  }
+
+  GPU_Image* GlyphAtlas::getImage() const
+  {
+    return this->image.get();
+  }
+
+  int32_t GlyphAtlas::getWidth() const
+  {
+    return kWidth;
+  }
+
+  int32_t GlyphAtlas::getHeight() const
+  {
+    return this->height;
+  }
+
+  int32_t GlyphAtlas::getLineHeight() const
+  {
+    return TTF_FontHeight(this->font.get());
+  }
+
+  void GlyphAtlas::loadGlyph(unsigned char character)
+  {
+    Glyph& glyph = this->glyphs[character];
+    glyph.isLoaded = true;
+
+    int32_t advance = 0;
+    TTF_GlyphMetrics(this->font.get(),
+                     character,
+                     nullptr, nullptr, nullptr, nullptr,
+                     &advance);
+    glyph.advance = advance;
+
+    // Rendering the character as text, instead of with TTF_RenderGlyph_*(),
+    // gets us the same bearing and height that TTF_RenderText_Blended() used
+    // to give the whole string.
+    const char text[2] = { static_cast<char>(character), '\0' };
+    SDL_Surface* renderedSurface = TTF_RenderText_Blended(
+      this->font.get(), text, SDL_Color{ 255, 255, 255, 255 });
+    if (renderedSurface == nullptr) {
+      return;
+    }
+
+    SDL_Surface* glyphSurface = SDL_ConvertSurfaceFormat(renderedSurface,
+                                                         SDL_PIXELFORMAT_RGBA32,
+                                                         0);
+    SDL_FreeSurface(renderedSurface);
+    if (glyphSurface == nullptr) {
+      return;
+    }
+
+    int32_t x = 0;
+    int32_t y = 0;
+    if (!this->reserveRect(glyphSurface->w, glyphSurface->h, x, y)) {
+      std::cout << "The glyph atlas is full. Unable to add the glyph for "
+                << "character " << static_cast<int32_t>(character) << "."
+                << std::endl;
+      SDL_FreeSurface(glyphSurface);
+      return;
+    }
+
+    SDL_LockSurface(glyphSurface);
+    const auto* srcPixels = static_cast<const uint8_t*>(glyphSurface->pixels);
+    const size_t rowSize = glyphSurface->w * _numChannels;
+    for (int32_t row = 0; row < glyphSurface->h; row++) {
+      std::memcpy(
+        this->pixels.data() + ((((y + row) * kWidth) + x) * _numChannels),
+        srcPixels + (row * glyphSurface->pitch),
+        rowSize);
+    }
+    SDL_UnlockSurface(glyphSurface);
+
+    glyph.srcRect = GPU_Rect{ static_cast<float>(x),
+                              static_cast<float>(y),
+                              static_cast<float>(glyphSurface->w),
+                              static_cast<float>(glyphSurface->h) };
+    glyph.hasImage = true;
+    SDL_FreeSurface(glyphSurface);
+
+    if (this->image) {
+      this->uploadPixels(glyph.srcRect);
+    } else {
+      // The first glyph creates the texture, which uploads everything.
+      this->grow();
+    }
+  }
+
+  bool GlyphAtlas::reserveRect(int32_t width,
+                               int32_t height,
+                               int32_t& x,
+                               int32_t& y)
+  {
+    const int32_t paddedWidth = width + kGlyphPadding;
+    const int32_t paddedHeight = height + kGlyphPadding;
+    if (paddedWidth > kWidth || paddedHeight > kMaxHeight) {
+      return false;
+    }
+
+    // Glyphs are packed into shelves, left to right.
+    if (this->shelfX + paddedWidth > kWidth) {
+      this->shelfY += this->shelfHeight;
+      this->shelfX = 0;
+      this->shelfHeight = 0;
+    }
+
+    while (this->shelfY + paddedHeight > this->height) {
+      if (this->height >= kMaxHeight) {
+        return false;
+      }
+
+      this->height = std::min(this->height * 2, kMaxHeight);
+      this->pixels.resize(kWidth * this->height * _numChannels, 0);
+      this->grow();
+    }
+
+    x = this->shelfX;
+    y = this->shelfY;
+    this->shelfX += paddedWidth;
+    this->shelfHeight = std::max(this->shelfHeight, paddedHeight);
+
+    return true;
+  }
+
+  void GlyphAtlas::grow()
+  {
+    // SDL_gpu can't resize an image, so a new one gets created. The old one
+    // can only be freed once no frame in flight uses it, which the lock
+    // takes care of.
+    GPUContextLock contextLock;
+
+    GPU_Image* newImage = GPU_CreateImage(kWidth,
+                                          this->height,
+                                          GPU_FORMAT_RGBA);
+    if (newImage == nullptr) {
+      std::cout << "Unable to create a glyph atlas texture." << std::endl;
+      this->image.reset();
+      return;
+    }
+
+    GPU_UpdateImageBytes(newImage,
+                         nullptr,
+                         this->pixels.data(),
+                         kWidth * _numChannels);
+    this->image.reset(newImage);
+  }
+
+  void GlyphAtlas::uploadPixels(const GPU_Rect& rect)
+  {
+    GPUContextLock contextLock;
+
+    const size_t firstPixelOffset =
+      ((static_cast<size_t>(rect.y) * kWidth) + static_cast<size_t>(rect.x))
+      * _numChannels;
+    GPU_UpdateImageBytes(this->image.get(),
+                         &rect,
+                         this->pixels.data() + firstPixelOffset,
+                         kWidth * _numChannels);
+  }
+
+  eastl::shared_ptr<GlyphAtlas> getGlyphAtlas(const Font& font)
+  {
+    auto& atlases = _getGlyphAtlases();
+    auto atlasIter = atlases.find(font.get());
+    if (atlasIter != atlases.end()) {
+      return atlasIter->second;
+    }
+
+    auto atlas = eastl::make_shared<GlyphAtlas>(font);
+    atlases[font.get()] = atlas;
+
+    return atlas;
+  }
+
+  void clearGlyphAtlases()
+  {
+    _getGlyphAtlases().clear();
+  }
+}
@@ -0,0 +1,89 @@
+#ifndef COREX_CORE_RENDERER_GLYPH_ATLAS_HPP
+#define COREX_CORE_RENDERER_GLYPH_ATLAS_HPP
+
+#include <cstdint>
+
+#include <EASTL/array.h>
+#include <EASTL/shared_ptr.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/asset_types/Font.hpp>
+#include <corex/core/sdl_deleters.hpp>
+
+namespace corex::core
+{
+  // A texture holding the glyphs of a font, which text gets drawn from. Fonts
+  // are opened at a fixed size, so there's one atlas per font and size. Glyphs
+  // are rasterized in white the first time they're asked for, and only the
+  // new glyph gets uploaded. Text is tinted through its vertex colours.
+  //
+  // The atlas keeps its width and grows taller when it runs out of space, so
+  // glyph rects stay valid, but texture coordinates computed from the old
+  // height don't. Convert to texture coordinates when drawing.
+  //
+  // Like TTF_RenderText_Blended(), characters are taken to be Latin-1.
+  class GlyphAtlas
+  {
+  public:
+    struct Glyph
+    {
+      // Where the glyph is in the atlas. Glyphs are as tall as the font,
+      // and are drawn with their top left corner on the pen position.
+      GPU_Rect srcRect;
+      int32_t advance;
+      bool hasImage; // False for glyphs like spaces, or ones that failed.
+      bool isLoaded;
+    };
+
+    explicit GlyphAtlas(Font font);
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    const Glyph& getGlyph(unsigned char character);
+    int32_t getKerning(unsigned char prevCharacter, unsigned char character);
+
+    GPU_Image* getImage() const;
+    int32_t getWidth() const;
+    int32_t getHeight() const;
+    int32_t getLineHeight() const;
+
+  private:
+    static constexpr int32_t kWidth = 512;
+    static constexpr int32_t kInitialHeight = 128;
+    static constexpr int32_t kMaxHeight = 4096;
+
+    // Keeps linear filtering from bleeding neighbouring glyphs in.
+    static constexpr int32_t kGlyphPadding = 1;
+
+    Font font;
+    eastl::array<Glyph, 256> glyphs;
+    eastl::vector<uint8_t> pixels; // RGBA. Kept around for when we grow.
+    eastl::unique_ptr<GPU_Image, SDLGPUImageDeleter> image;
+    int32_t height;
+    int32_t shelfX;
+    int32_t shelfY;
+    int32_t shelfHeight;
+
+    void loadGlyph(unsigned char character);
+    bool reserveRect(int32_t width, int32_t height, int32_t& x, int32_t& y);
+    void grow();
+    void uploadPixels(const GPU_Rect& rect);
+  };
+
+  // Returns the atlas of the font, creating it the first time it's asked for.
+  eastl::shared_ptr<GlyphAtlas> getGlyphAtlas(const Font& font);
+
+  // Frees every atlas that isn't in use anymore.
+  void clearGlyphAtlases();
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include <cstdint>
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/ImageUpdateQueue.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  ImageUpdateQueue::ImageUpdateQueue()
+    : updates()
+    , numUpdates(0)
+    , recordedImages() {}
+
+  void ImageUpdateQueue::add(eastl::shared_ptr<GPU_Image> image,
+                             const uint8_t* pixels,
+                             int32_t numBytesPerRow)
+  {
+    int32_t updateIndex = 0;
+    while (updateIndex < this->numUpdates
+           && this->updates[updateIndex].image != image) {
+      updateIndex++;
+    }
+
+    if (updateIndex == this->numUpdates) {
+      if (this->numUpdates == this->updates.size()) {
+        this->updates.push_back(ImageUpdate{ nullptr, {}, 0 });
+      }
+
+      this->numUpdates++;
+    }
+
+    ImageUpdate& update = this->updates[updateIndex];
+    update.image = image;
+    update.pixels.assign(pixels, pixels + (numBytesPerRow * image->h));
+    update.numBytesPerRow = numBytesPerRow;
+  }
+
+  void ImageUpdateQueue::record(RenderCommandList& commandList)
+  {
+    // The previous frame has been handed off by now, and freeing an image
+    // waits for the frames in flight to be drawn. So it's fine if these are
+    // the last references to the images.
+    this->recordedImages.clear();
+
+    for (int32_t i = 0; i < this->numUpdates; i++) {
+      ImageUpdate& update = this->updates[i];
+      commandList.addImageUpdate(update.image.get(),
+                                 update.pixels.data(),
+                                 update.numBytesPerRow);
+      this->recordedImages.push_back(eastl::move(update.image));
+    }
+
+    this->numUpdates = 0;
+  }
+
+  ImageUpdateQueue& getImageUpdateQueue()
+  {
+    static ImageUpdateQueue imageUpdateQueue;
+    return imageUpdateQueue;
+  }
+}
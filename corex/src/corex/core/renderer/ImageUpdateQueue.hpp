@@ -0,0 +1,58 @@
+#ifndef COREX_CORE_RENDERER_IMAGE_UPDATE_QUEUE_HPP
+#define COREX_CORE_RENDERER_IMAGE_UPDATE_QUEUE_HPP
+
+#include <cstdint>
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/vector.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Holds on to image updates made outside of rendering, e.g. by scenes,
+  // until they get recorded into the next frame's command list. Uploading
+  // pixels directly would need a GPUContextLock, which waits for the render
+  // thread to finish every frame in flight. Only use it from the main thread.
+  class ImageUpdateQueue
+  {
+  public:
+    ImageUpdateQueue();
+
+    // The pixels are copied. The image's rows must be numBytesPerRow bytes
+    // long. Queueing another update to the same image replaces the queued
+    // one, since only the latest pixels matter.
+    void add(eastl::shared_ptr<GPU_Image> image,
+             const uint8_t* pixels,
+             int32_t numBytesPerRow);
+
+    // Moves the queued updates into the command list.
+    void record(RenderCommandList& commandList);
+
+  private:
+    struct ImageUpdate
+    {
+      eastl::shared_ptr<GPU_Image> image;
+      eastl::vector<uint8_t> pixels;
+      int32_t numBytesPerRow;
+    };
+
+    // Updates past numUpdates are kept around to reuse their pixel buffers.
+    eastl::vector<ImageUpdate> updates;
+    int32_t numUpdates;
+
+    // Kept alive until the frame they were recorded into is handed off.
+    eastl::vector<eastl::shared_ptr<GPU_Image>> recordedImages;
+  };
+
+  // Application records the queued updates at the start of every frame.
+  ImageUpdateQueue& getImageUpdateQueue();
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
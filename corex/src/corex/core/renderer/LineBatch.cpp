@@ -0,0 +1,226 @@
+#include <cstdint>
+
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+#include <SDL2/SDL.h>
+
+#include <corex/core/utils.hpp>
+#include <corex/core/components/Position.hpp>
+#include <corex/core/components/Renderable.hpp>
+#include <corex/core/components/RenderLineSegments.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/LineBatch.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  uint32_t _getEntityID(entt::entity entity)
+  {
+    return static_cast<uint32_t>(entity);
+  }
+
+  bool _isEntityVisible(const entt::registry& registry, entt::entity entity)
+  {
+    const auto* renderable = registry.try_get<Renderable>(entity);
+    return renderable == nullptr || renderable->isVisible;
+  }
+  /////////////////////////////////////////////////
+
+  LineBatch::LineBatch(entt::registry& registry)
+    : registry(registry)
+    , buckets()
+    , entityBucketIndexes()
+    , currFrame(0)
+    , numDrawCalls(0)
+    , isRebuildNeeded(true)
+  {
+    this->registry.on_construct<RenderLineSegments>()
+                  .connect<&LineBatch::handleLineSegmentsChanges>(this);
+    this->registry.on_update<RenderLineSegments>()
+                  .connect<&LineBatch::handleLineSegmentsChanges>(this);
+    this->registry.on_destroy<RenderLineSegments>()
+                  .connect<&LineBatch::handleLineSegmentsChanges>(this);
+  }
+
+  LineBatch::~LineBatch()
+  {
+    this->registry.on_construct<RenderLineSegments>()
+                  .disconnect<&LineBatch::handleLineSegmentsChanges>(this);
+    this->registry.on_update<RenderLineSegments>()
+                  .disconnect<&LineBatch::handleLineSegmentsChanges>(this);
+    this->registry.on_destroy<RenderLineSegments>()
+                  .disconnect<&LineBatch::handleLineSegmentsChanges>(this);
+  }
+
+  void LineBatch::update()
+  {
+    this->currFrame++;
+    this->numDrawCalls = 0;
+
+    if (this->isRebuildNeeded || this->areBucketsOutdated()) {
+      this->rebuildBuckets();
+    }
+  }
+
+  void LineBatch::record(RenderCommandList& commandList, entt::entity entity)
+  {
+    auto bucketIndexIter = this->entityBucketIndexes.find(_getEntityID(entity));
+    if (bucketIndexIter == this->entityBucketIndexes.end()) {
+      return;
+    }
+
+    Bucket& bucket = this->buckets[bucketIndexIter->second];
+    if (bucket.lastRecordedFrame == this->currFrame) {
+      return;
+    }
+
+    for (Chunk& chunk : bucket.chunks) {
+      if (chunk.indexes.empty()) {
+        continue;
+      }
+
+      commandList.addLines(chunk.vertexValues.data(),
+                           chunk.numVertices,
+                           chunk.indexes.data(),
+                           chunk.indexes.size());
+      this->numDrawCalls++;
+    }
+
+    bucket.lastRecordedFrame = this->currFrame;
+  }
+
+  int32_t LineBatch::getNumDrawCalls() const
+  {
+    return this->numDrawCalls;
+  }
+
+  void LineBatch::handleLineSegmentsChanges(entt::registry& registry,
+                                            entt::entity entity)
+  {
+    // Destruction signals are fired before the component gets removed, so we
+    // can't rebuild here. Defer it to the next update instead.
+    this->isRebuildNeeded = true;
+  }
+
+  bool LineBatch::areBucketsOutdated()
+  {
+    // Positions are written to directly, so we have to check if the sorting
+    // layer and z of each line segments entity still match its bucket. There
+    // are only a few of these entities, so this is cheap.
+    int32_t numEntities = 0;
+    auto lineSegments = this->registry.view<Position, RenderLineSegments>();
+    for (entt::entity e : lineSegments) {
+      auto bucketIndexIter = this->entityBucketIndexes.find(_getEntityID(e));
+      const bool isInBucket = bucketIndexIter
+                              != this->entityBucketIndexes.end();
+      if (!_isEntityVisible(this->registry, e)) {
+        // Hidden entities are left out of the buckets.
+        if (isInBucket) {
+          return true;
+        }
+
+        continue;
+      }
+
+      if (!isInBucket) {
+        return true;
+      }
+
+      const Position& pos = lineSegments.get<Position>(e);
+      const Bucket& bucket = this->buckets[bucketIndexIter->second];
+      if (pos.sortingLayerID != bucket.sortingLayerID || pos.z != bucket.z) {
+        return true;
+      }
+
+      numEntities++;
+    }
+
+    return numEntities != static_cast<int32_t>(
+      this->entityBucketIndexes.size());
+  }
+
+  void LineBatch::rebuildBuckets()
+  {
+    this->buckets.clear();
+    this->entityBucketIndexes.clear();
+
+    auto lineSegments = this->registry.view<Position, RenderLineSegments>();
+    for (entt::entity e : lineSegments) {
+      if (!_isEntityVisible(this->registry, e)) {
+        continue;
+      }
+
+      const Position& pos = lineSegments.get<Position>(e);
+      const RenderLineSegments& segments = lineSegments
+                                             .get<RenderLineSegments>(e);
+      const int32_t bucketIndex = this->findOrAddBucket(pos.sortingLayerID,
+                                                        pos.z,
+                                                        segments.colour);
+      this->entityBucketIndexes[_getEntityID(e)] = bucketIndex;
+
+      if (segments.vertices.size() <= 1) {
+        // Not enough vertices to form a line.
+        continue;
+      }
+
+      const float r = segments.colour.r / 255.f;
+      const float g = segments.colour.g / 255.f;
+      const float b = segments.colour.b / 255.f;
+      const float a = segments.colour.a / 255.f;
+
+      // Each segment is a pair of indexes into the chunk's vertices. When a
+      // chunk fills up, the polyline continues in a new chunk, starting from
+      // the last vertex added to the previous chunk.
+      eastl::vector<Chunk>& chunks = this->buckets[bucketIndex].chunks;
+      if (chunks.empty() || chunks.back().numVertices + 2 > kMaxNumVertices) {
+        chunks.push_back(Chunk{ {}, {}, 0 });
+      }
+
+      for (int32_t i = 0; i < segments.vertices.size(); i++) {
+        if (chunks.back().numVertices == kMaxNumVertices) {
+          chunks.push_back(Chunk{ {}, {}, 0 });
+
+          const Point& prevVertex = segments.vertices[i - 1];
+          chunks.back().vertexValues.insert(
+            chunks.back().vertexValues.end(),
+            { prevVertex.x, prevVertex.y, r, g, b, a }
+          );
+          chunks.back().numVertices++;
+        }
+
+        Chunk& chunk = chunks.back();
+        const Point& vertex = segments.vertices[i];
+        chunk.vertexValues.insert(chunk.vertexValues.end(),
+                                  { vertex.x, vertex.y, r, g, b, a });
+        chunk.numVertices++;
+
+        if (i > 0) {
+          chunk.indexes.push_back(
+            static_cast<unsigned short>(chunk.numVertices - 2));
+          chunk.indexes.push_back(
+            static_cast<unsigned short>(chunk.numVertices - 1));
+        }
+      }
+    }
+
+    this->isRebuildNeeded = false;
+  }
+
+  int32_t LineBatch::findOrAddBucket(int8_t sortingLayerID,
+                                     float z,
+                                     SDL_Color colour)
+  {
+    for (int32_t i = 0; i < this->buckets.size(); i++) {
+      const Bucket& bucket = this->buckets[i];
+      if (bucket.sortingLayerID == sortingLayerID
+          && bucket.z == z
+          && areColoursEqual(bucket.colour, colour)) {
+        return i;
+      }
+    }
+
+    this->buckets.push_back(Bucket{ sortingLayerID, z, colour, {}, 0 });
+    return static_cast<int32_t>(this->buckets.size()) - 1;
+  }
+}
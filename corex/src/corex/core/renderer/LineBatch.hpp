@@ -0,0 +1,88 @@
+#ifndef COREX_CORE_RENDERER_LINE_BATCH_HPP
+#define COREX_CORE_RENDERER_LINE_BATCH_HPP
+
+#include <cstdint>
+
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+#include <SDL2/SDL.h>
+
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Packs the vertices of LINE_SEGMENTS renderables into persistent vertex
+  // buffers, with one bucket per sorting layer, z, and colour. Each bucket is
+  // recorded as one LINES command per 65535 vertices, which is drawn with one
+  // GPU_PrimitiveBatch() call, instead of one GPU_Line() call per segment.
+  //
+  // The buckets are only rebuilt when a RenderLineSegments gets added,
+  // replaced, patched, or removed, or when the sorting layer or z of a line
+  // segments entity changes. Modify the vertices of a RenderLineSegments
+  // through registry.patch() or registry.replace() so that the change gets
+  // picked up. Hidden entities are left out of the buckets, and showing or
+  // hiding one also rebuilds them.
+  class LineBatch
+  {
+  public:
+    explicit LineBatch(entt::registry& registry);
+    ~LineBatch();
+
+    LineBatch(const LineBatch&) = delete;
+    LineBatch& operator=(const LineBatch&) = delete;
+
+    // Must be called once per frame, before recording.
+    void update();
+
+    // Records the bucket the entity belongs to, unless the bucket has already
+    // been recorded this frame. All entities in a bucket share a sorting layer
+    // and z, so they are next to each other in the draw order. The vertices
+    // get copied into the command list, since the buckets might be rebuilt
+    // while the list is still being drawn.
+    void record(RenderCommandList& commandList, entt::entity entity);
+
+    int32_t getNumDrawCalls() const;
+
+  private:
+    // Indexes passed to GPU_PrimitiveBatch() are unsigned shorts, so a single
+    // draw call can't have more vertices than this.
+    static constexpr int32_t kMaxNumVertices = 65535;
+
+    struct Chunk
+    {
+      eastl::vector<float> vertexValues; // x, y, r, g, b, a per vertex.
+      eastl::vector<unsigned short> indexes;
+      int32_t numVertices;
+    };
+
+    struct Bucket
+    {
+      int8_t sortingLayerID;
+      float z;
+      SDL_Color colour;
+      eastl::vector<Chunk> chunks;
+      uint64_t lastRecordedFrame;
+    };
+
+    entt::registry& registry;
+    eastl::vector<Bucket> buckets;
+    eastl::unordered_map<uint32_t, int32_t> entityBucketIndexes;
+    uint64_t currFrame;
+    int32_t numDrawCalls;
+    bool isRebuildNeeded;
+
+    void handleLineSegmentsChanges(entt::registry& registry,
+                                   entt::entity entity);
+    bool areBucketsOutdated();
+    void rebuildBuckets();
+    int32_t findOrAddBucket(int8_t sortingLayerID, float z, SDL_Color colour);
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
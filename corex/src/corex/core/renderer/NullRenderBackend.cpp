@@ -0,0 +1,93 @@
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/NullRenderBackend.hpp>
+#include <corex/core/renderer/RenderBackend.hpp>
+
+namespace corex::core
+{
+  NullRenderBackend::NullRenderBackend()
+    : numCommands(0)
+    , numVertices(0) {}
+
+  void NullRenderBackend::clear(SDL_Color colour)
+  {
+    this->numCommands++;
+  }
+
+  void NullRenderBackend::setCamera(const GPU_Camera& camera)
+  {
+    this->numCommands++;
+  }
+
+  void NullRenderBackend::blit(GPU_Image* image,
+                               const GPU_Rect& srcRect,
+                               const GPU_Rect& dstRect)
+  {
+    this->numCommands++;
+    this->numVertices += 4;
+  }
+
+  void NullRenderBackend::drawPolygon(float* vertices,
+                                      int32_t numVertices,
+                                      SDL_Color colour)
+  {
+    this->numCommands++;
+    this->numVertices += numVertices;
+  }
+
+  void NullRenderBackend::drawTriangles(float* vertexValues,
+                                        int32_t numVertices,
+                                        unsigned short* indexes,
+                                        int32_t numIndexes)
+  {
+    this->numCommands++;
+    this->numVertices += numVertices;
+  }
+
+  void NullRenderBackend::drawLines(float* vertexValues,
+                                    int32_t numVertices,
+                                    unsigned short* indexes,
+                                    int32_t numIndexes)
+  {
+    this->numCommands++;
+    this->numVertices += numVertices;
+  }
+
+  void NullRenderBackend::drawCircle(float x,
+                                     float y,
+                                     float radius,
+                                     SDL_Color colour)
+  {
+    this->numCommands++;
+  }
+
+  void NullRenderBackend::drawTexturedTriangles(GPU_Image* image,
+                                                float* vertexValues,
+                                                int32_t numVertices,
+                                                unsigned short* indexes,
+                                                int32_t numIndexes)
+  {
+    this->numCommands++;
+    this->numVertices += numVertices;
+  }
+
+  void NullRenderBackend::updateImage(GPU_Image* image,
+                                      const uint8_t* pixels,
+                                      int32_t numBytesPerRow)
+  {
+    this->numCommands++;
+  }
+
+  int64_t NullRenderBackend::getNumCommands() const
+  {
+    return this->numCommands;
+  }
+
+  int64_t NullRenderBackend::getNumVertices() const
+  {
+    return this->numVertices;
+  }
+}
@@ -0,0 +1,60 @@
+#ifndef COREX_CORE_RENDERER_NULL_RENDER_BACKEND_HPP
+#define COREX_CORE_RENDERER_NULL_RENDER_BACKEND_HPP
+
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderBackend.hpp>
+
+namespace corex::core
+{
+  // Draws nothing. It only keeps count of the commands and vertices it was
+  // given, which is what the null renderer uses.
+  class NullRenderBackend : public RenderBackend
+  {
+  public:
+    NullRenderBackend();
+
+    void clear(SDL_Color colour) override;
+    void setCamera(const GPU_Camera& camera) override;
+    void blit(GPU_Image* image,
+              const GPU_Rect& srcRect,
+              const GPU_Rect& dstRect) override;
+    void drawPolygon(float* vertices,
+                     int32_t numVertices,
+                     SDL_Color colour) override;
+    void drawTriangles(float* vertexValues,
+                       int32_t numVertices,
+                       unsigned short* indexes,
+                       int32_t numIndexes) override;
+    void drawLines(float* vertexValues,
+                   int32_t numVertices,
+                   unsigned short* indexes,
+                   int32_t numIndexes) override;
+    void drawCircle(float x, float y, float radius, SDL_Color colour) override;
+    void drawTexturedTriangles(GPU_Image* image,
+                               float* vertexValues,
+                               int32_t numVertices,
+                               unsigned short* indexes,
+                               int32_t numIndexes) override;
+    void updateImage(GPU_Image* image,
+                     const uint8_t* pixels,
+                     int32_t numBytesPerRow) override;
+
+    int64_t getNumCommands() const;
+    int64_t getNumVertices() const;
+
+  private:
+    int64_t numCommands;
+    int64_t numVertices;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
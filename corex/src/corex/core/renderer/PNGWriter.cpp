@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <zlib.h>
+
+#include <corex/core/renderer/PNGWriter.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  constexpr int32_t _numBytesPerPixel = 4;
+
+  // The "Up" filter. It stores each byte as the difference from the byte
+  // above it, which compresses rendered frames (lots of flat colours) well.
+  constexpr uint8_t _pngUpFilterType = 2;
+
+  void _writeBigEndianUInt32(uint8_t* dest, uint32_t value)
+  {
+    dest[0] = static_cast<uint8_t>(value >> 24);
+    dest[1] = static_cast<uint8_t>(value >> 16);
+    dest[2] = static_cast<uint8_t>(value >> 8);
+    dest[3] = static_cast<uint8_t>(value);
+  }
+
+  bool _writePNGChunk(FILE* file,
+                      const char* type,
+                      const uint8_t* data,
+                      uint32_t dataSize)
+  {
+    uint8_t header[8];
+    _writeBigEndianUInt32(header, dataSize);
+    std::memcpy(header + 4, type, 4);
+
+    // The CRC covers the chunk type and data, but not the length.
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(type), 4);
+    if (dataSize > 0) {
+      crc = crc32(crc, data, dataSize);
+    }
+
+    uint8_t footer[4];
+    _writeBigEndianUInt32(footer, static_cast<uint32_t>(crc));
+
+    return std::fwrite(header, 1, sizeof(header), file) == sizeof(header)
+           && (dataSize == 0
+               || std::fwrite(data, 1, dataSize, file) == dataSize)
+           && std::fwrite(footer, 1, sizeof(footer), file) == sizeof(footer);
+  }
+  /////////////////////////////////////////////////
+
+  PNGWriter::PNGWriter()
+    : filteredRows()
+    , compressedData() {}
+
+  bool PNGWriter::write(const eastl::string& filePath,
+                        const uint8_t* pixels,
+                        int32_t width,
+                        int32_t height,
+                        bool isBottomUp)
+  {
+    this->filterRows(pixels, width, height, isBottomUp);
+
+    uLongf compressedSize = compressBound(this->filteredRows.size());
+    this->compressedData.resize(compressedSize);
+
+    // Frames have to be written quickly, so we favour speed over size.
+    int compressionResult = compress2(this->compressedData.data(),
+                                      &compressedSize,
+                                      this->filteredRows.data(),
+                                      this->filteredRows.size(),
+                                      Z_BEST_SPEED);
+    if (compressionResult != Z_OK) {
+      return false;
+    }
+
+    FILE* file = std::fopen(filePath.c_str(), "wb");
+    if (file == nullptr) {
+      return false;
+    }
+
+    const uint8_t signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+
+    // Width, height, bit depth (8), colour type (6, RGBA), compression method,
+    // filter method, and interlace method.
+    uint8_t ihdr[13] = {};
+    _writeBigEndianUInt32(ihdr, static_cast<uint32_t>(width));
+    _writeBigEndianUInt32(ihdr + 4, static_cast<uint32_t>(height));
+    ihdr[8] = 8;
+    ihdr[9] = 6;
+
+    bool isWriteSuccessful =
+      std::fwrite(signature, 1, sizeof(signature), file) == sizeof(signature)
+      && _writePNGChunk(file, "IHDR", ihdr, sizeof(ihdr))
+      && _writePNGChunk(file,
+                        "IDAT",
+                        this->compressedData.data(),
+                        static_cast<uint32_t>(compressedSize))
+      && _writePNGChunk(file, "IEND", nullptr, 0);
+
+    return (std::fclose(file) == 0) && isWriteSuccessful;
+  }
+
+  void PNGWriter::filterRows(const uint8_t* pixels,
+                             int32_t width,
+                             int32_t height,
+                             bool isBottomUp)
+  {
+    const int32_t rowSize = width * _numBytesPerPixel;
+    const int32_t filteredRowSize = rowSize + 1; // Includes the filter type.
+    this->filteredRows.resize(static_cast<size_t>(filteredRowSize) * height);
+
+    const uint8_t* prevRow = nullptr;
+    for (int32_t y = 0; y < height; y++) {
+      const int32_t srcY = isBottomUp ? (height - 1 - y) : y;
+      const uint8_t* row = pixels + (static_cast<size_t>(srcY) * rowSize);
+      uint8_t* filteredRow = this->filteredRows.data()
+                             + (static_cast<size_t>(y) * filteredRowSize);
+
+      filteredRow[0] = _pngUpFilterType;
+      if (prevRow == nullptr) {
+        // There is no row above the first row, so Up keeps the bytes as is.
+        std::memcpy(filteredRow + 1, row, rowSize);
+      } else {
+        for (int32_t i = 0; i < rowSize; i++) {
+          filteredRow[i + 1] = static_cast<uint8_t>(row[i] - prevRow[i]);
+        }
+      }
+
+      prevRow = row;
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef COREX_CORE_RENDERER_PNG_WRITER_HPP
+#define COREX_CORE_RENDERER_PNG_WRITER_HPP
+
+#include <cstdint>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+namespace corex::core
+{
+  // Writes 8-bit RGBA images as PNG files, using zlib for compression. The
+  // buffers used while encoding are kept between writes, so writing frames of
+  // the same size over and over doesn't allocate. Not thread-safe. Use one
+  // writer per thread.
+  class PNGWriter
+  {
+  public:
+    PNGWriter();
+
+    // Pixels must be tightly packed. Set isBottomUp if the first row in the
+    // pixels is the bottom row of the image, which is what glReadPixels()
+    // gives us.
+    bool write(const eastl::string& filePath,
+               const uint8_t* pixels,
+               int32_t width,
+               int32_t height,
+               bool isBottomUp);
+
+  private:
+    eastl::vector<uint8_t> filteredRows;
+    eastl::vector<uint8_t> compressedData;
+
+    void filterRows(const uint8_t* pixels,
+                    int32_t width,
+                    int32_t height,
+                    bool isBottomUp);
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef COREX_CORE_RENDERER_RENDER_BACKEND_HPP
+#define COREX_CORE_RENDERER_RENDER_BACKEND_HPP
+
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+namespace corex::core
+{
+  // Executes the commands of a RenderCommandList. See RenderCommand for what
+  // each command expects. Vertex and index pointers are only valid for the
+  // duration of the call.
+  class RenderBackend
+  {
+  public:
+    virtual ~RenderBackend() = default;
+
+    virtual void clear(SDL_Color colour) = 0;
+    virtual void setCamera(const GPU_Camera& camera) = 0;
+
+    // The image is null for frames that were read back from a file.
+    virtual void blit(GPU_Image* image,
+                      const GPU_Rect& srcRect,
+                      const GPU_Rect& dstRect) = 0;
+    virtual void drawPolygon(float* vertices,
+                             int32_t numVertices,
+                             SDL_Color colour) = 0;
+    virtual void drawTriangles(float* vertexValues,
+                               int32_t numVertices,
+                               unsigned short* indexes,
+                               int32_t numIndexes) = 0;
+    virtual void drawLines(float* vertexValues,
+                           int32_t numVertices,
+                           unsigned short* indexes,
+                           int32_t numIndexes) = 0;
+    virtual void drawCircle(float x,
+                            float y,
+                            float radius,
+                            SDL_Color colour) = 0;
+
+    // The image is null for frames that were read back from a file.
+    virtual void drawTexturedTriangles(GPU_Image* image,
+                                       float* vertexValues,
+                                       int32_t numVertices,
+                                       unsigned short* indexes,
+                                       int32_t numIndexes) = 0;
+
+    // Replaces all the pixels of the image. The image is null for frames that
+    // were read back from a file.
+    virtual void updateImage(GPU_Image* image,
+                             const uint8_t* pixels,
+                             int32_t numBytesPerRow) = 0;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef COREX_CORE_RENDERER_RENDER_COMMAND_HPP
+#define COREX_CORE_RENDERER_RENDER_COMMAND_HPP
+
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderCommandType.hpp>
+
+namespace corex::core
+{
+  // A single draw command in a RenderCommandList, packed into 32 bytes. Only
+  // the data used by the command's type is set. Anything bigger than a few
+  // values, like vertices, rects, and cameras, lives in the list, with the
+  // command keeping an index to it.
+  //
+  // - CLEAR uses colour.
+  // - SET_CAMERA uses camera.
+  // - BLIT uses blit. The source and destination rects are next to each
+  //   other in the list's rects.
+  // - POLYGON draws an unfilled polygon, and uses colour and geometry, with
+  //   vertices being x, y pairs. Filled polygons are drawn as TRIANGLES.
+  // - TRIANGLES and LINES use geometry, with vertices being x, y, r, g, b, a.
+  // - CIRCLE draws an unfilled circle, and uses colour and circle. Filled
+  //   circles are drawn as TRIANGLES.
+  // - TEXTURED_TRIANGLES uses texturedGeometry, with vertices being x, y, s,
+  //   t, r, g, b, a.
+  // - UPDATE_IMAGE uses imageUpdate. The new pixels of the whole image are in
+  //   the list's pixels, row by row.
+  struct RenderCommand
+  {
+    struct CameraData
+    {
+      int32_t cameraIndex;
+    };
+
+    struct BlitData
+    {
+      GPU_Image* image;
+      int32_t rectIndex;
+    };
+
+    struct GeometryData
+    {
+      int32_t vertexValueOffset;
+      int32_t numVertices;
+      int32_t indexOffset;
+      int32_t numIndexes;
+    };
+
+    struct CircleData
+    {
+      float x;
+      float y;
+      float radius;
+    };
+
+    struct TexturedGeometryData
+    {
+      GPU_Image* image;
+      GeometryData geometry;
+    };
+
+    struct ImageUpdateData
+    {
+      GPU_Image* image;
+      int32_t pixelOffset;
+      int32_t numBytesPerRow;
+      int32_t numRows;
+    };
+
+    RenderCommandType type;
+    SDL_Color colour;
+    union
+    {
+      CameraData camera;
+      BlitData blit;
+      GeometryData geometry;
+      CircleData circle;
+      TexturedGeometryData texturedGeometry;
+      ImageUpdateData imageUpdate;
+    };
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
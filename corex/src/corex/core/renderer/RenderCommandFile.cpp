@@ -0,0 +1,138 @@
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <EASTL/string.h>
+
+#include <corex/core/renderer/RenderCommand.hpp>
+#include <corex/core/renderer/RenderCommandFile.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  constexpr char _fileMagic[4] = { 'C', 'X', 'R', 'C' };
+  constexpr uint32_t _fileVersion = 2;
+
+  // Names starting with an underscore and a capital letter are reserved, so
+  // types don't get the underscore. They're kept to this file instead.
+  namespace
+  {
+    struct FileHeader
+    {
+      char magic[4];
+      uint32_t version;
+      uint32_t commandSize;
+    };
+  }
+  /////////////////////////////////////////////////
+
+  RenderCommandFileWriter::RenderCommandFileWriter()
+    : file() {}
+
+  bool RenderCommandFileWriter::open(const eastl::string& filePath)
+  {
+    this->close();
+
+    this->file.open(filePath.c_str(),
+                    std::ofstream::binary | std::ofstream::trunc);
+    if (!this->file) {
+      std::cout << "Unable to open " << filePath.c_str()
+                << " for recording render commands." << std::endl;
+      return false;
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, _fileMagic, sizeof(_fileMagic));
+    header.version = _fileVersion;
+    header.commandSize = sizeof(RenderCommand);
+    this->file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    return true;
+  }
+
+  void RenderCommandFileWriter::close()
+  {
+    if (this->file.is_open()) {
+      this->file.close();
+    }
+  }
+
+  bool RenderCommandFileWriter::isOpen() const
+  {
+    return this->file.is_open();
+  }
+
+  void RenderCommandFileWriter::writeFrame(const RenderCommandList& commandList)
+  {
+    if (!this->file.is_open()) {
+      return;
+    }
+
+    commandList.write(this->file);
+  }
+
+  RenderCommandFileReader::RenderCommandFileReader()
+    : file()
+    , firstFramePos() {}
+
+  bool RenderCommandFileReader::open(const eastl::string& filePath)
+  {
+    this->close();
+
+    this->file.open(filePath.c_str(), std::ifstream::binary);
+    if (!this->file) {
+      std::cout << "Unable to open " << filePath.c_str()
+                << " for replaying render commands." << std::endl;
+      return false;
+    }
+
+    FileHeader header{};
+    this->file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!this->file
+        || std::memcmp(header.magic, _fileMagic, sizeof(_fileMagic)) != 0
+        || header.version != _fileVersion
+        || header.commandSize != sizeof(RenderCommand)) {
+      std::cout << filePath.c_str() << " is not a render command recording, "
+                << "or was recorded by a different build." << std::endl;
+      this->close();
+      return false;
+    }
+
+    this->firstFramePos = this->file.tellg();
+
+    return true;
+  }
+
+  void RenderCommandFileReader::close()
+  {
+    if (this->file.is_open()) {
+      this->file.close();
+    }
+  }
+
+  bool RenderCommandFileReader::isOpen() const
+  {
+    return this->file.is_open();
+  }
+
+  bool RenderCommandFileReader::readFrame(RenderCommandList& commandList)
+  {
+    if (!this->file.is_open()) {
+      return false;
+    }
+
+    return commandList.read(this->file);
+  }
+
+  void RenderCommandFileReader::rewind()
+  {
+    if (!this->file.is_open()) {
+      return;
+    }
+
+    this->file.clear();
+    this->file.seekg(this->firstFramePos);
+  }
+}
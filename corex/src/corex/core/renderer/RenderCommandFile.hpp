@@ -0,0 +1,58 @@
+#ifndef COREX_CORE_RENDERER_RENDER_COMMAND_FILE_HPP
+#define COREX_CORE_RENDERER_RENDER_COMMAND_FILE_HPP
+
+#include <fstream>
+
+#include <EASTL/string.h>
+
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Recorded frames are stored back to back after a small header, each frame
+  // being written by RenderCommandList::write(). The files are only meant to
+  // be read by the build that wrote them, since commands are stored as they
+  // are in memory. A reader refuses files with a different command layout.
+  class RenderCommandFileWriter
+  {
+  public:
+    RenderCommandFileWriter();
+
+    bool open(const eastl::string& filePath);
+    void close();
+    bool isOpen() const;
+
+    void writeFrame(const RenderCommandList& commandList);
+
+  private:
+    std::ofstream file;
+  };
+
+  class RenderCommandFileReader
+  {
+  public:
+    RenderCommandFileReader();
+
+    bool open(const eastl::string& filePath);
+    void close();
+    bool isOpen() const;
+
+    // Returns false once there are no frames left, or if the next frame is
+    // corrupted.
+    bool readFrame(RenderCommandList& commandList);
+
+    // Goes back to the first frame.
+    void rewind();
+
+  private:
+    std::ifstream file;
+    std::streampos firstFramePos;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
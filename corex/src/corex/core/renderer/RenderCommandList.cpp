@@ -0,0 +1,749 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+#include <imgui.h>
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/utils.hpp>
+#include <corex/core/renderer/RenderBackend.hpp>
+#include <corex/core/renderer/RenderCommand.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+#include <corex/core/renderer/RenderCommandType.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  constexpr int32_t _numValuesPerVertex = 2;
+  constexpr int32_t _numValuesPerColouredVertex = 6;
+  constexpr int32_t _numValuesPerTexturedVertex = 8;
+
+  // ImVector's assignment operator frees its memory before copying, so we
+  // copy by hand to keep the capacity we already have.
+  template <typename T>
+  void _copyImVector(ImVector<T>& dest, const ImVector<T>& src)
+  {
+    dest.resize(src.Size);
+    if (src.Size > 0) {
+      std::memcpy(dest.Data, src.Data, src.Size * sizeof(T));
+    }
+  }
+
+  template <typename T>
+  void _writeArray(std::ostream& stream, const eastl::vector<T>& array)
+  {
+    const int32_t numElements = static_cast<int32_t>(array.size());
+    stream.write(reinterpret_cast<const char*>(&numElements),
+                 sizeof(numElements));
+    stream.write(reinterpret_cast<const char*>(array.data()),
+                 numElements * sizeof(T));
+  }
+
+  // Returns the number of bytes left to read in the stream, or -1 if the
+  // stream can't tell.
+  std::streamoff _getNumBytesLeft(std::istream& stream)
+  {
+    const std::streampos currPos = stream.tellg();
+    if (currPos == std::streampos(-1)) {
+      return -1;
+    }
+
+    stream.seekg(0, std::ios::end);
+    const std::streampos endPos = stream.tellg();
+    stream.seekg(currPos);
+    if (!stream || endPos == std::streampos(-1)) {
+      return -1;
+    }
+
+    return endPos - currPos;
+  }
+
+  template <typename T>
+  bool _readArray(std::istream& stream, eastl::vector<T>& array)
+  {
+    int32_t numElements = 0;
+    stream.read(reinterpret_cast<char*>(&numElements), sizeof(numElements));
+    if (!stream || numElements < 0) {
+      return false;
+    }
+
+    // The count comes from the file, so make sure there's that much data
+    // left before we allocate room for it. Streams we can't check are
+    // refused, rather than trusting a count that may be garbage.
+    const std::streamoff numBytesLeft = _getNumBytesLeft(stream);
+    if (numBytesLeft < 0
+        || static_cast<uint64_t>(numElements) * sizeof(T)
+           > static_cast<uint64_t>(numBytesLeft)) {
+      stream.setstate(std::ios::failbit);
+      return false;
+    }
+
+    array.resize(numElements);
+    stream.read(reinterpret_cast<char*>(array.data()),
+                numElements * sizeof(T));
+
+    return static_cast<bool>(stream);
+  }
+
+  bool _areRectsEqual(const GPU_Rect& a, const GPU_Rect& b)
+  {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+  }
+
+  bool _areCamerasEqual(const GPU_Camera& a, const GPU_Camera& b)
+  {
+    return a.x == b.x && a.y == b.y && a.z == b.z
+           && a.angle == b.angle
+           && a.zoom_x == b.zoom_x && a.zoom_y == b.zoom_y
+           && a.z_near == b.z_near && a.z_far == b.z_far
+           && a.use_centered_origin == b.use_centered_origin;
+  }
+
+  // Only valid for commands with geometry.
+  const RenderCommand::GeometryData& _getGeometry(const RenderCommand& command)
+  {
+    return (command.type == RenderCommandType::TEXTURED_TRIANGLES)
+           ? command.texturedGeometry.geometry
+           : command.geometry;
+  }
+
+  RenderCommand::GeometryData& _getGeometry(RenderCommand& command)
+  {
+    return (command.type == RenderCommandType::TEXTURED_TRIANGLES)
+           ? command.texturedGeometry.geometry
+           : command.geometry;
+  }
+
+  int32_t _getNumValuesPerVertex(RenderCommandType type)
+  {
+    switch (type) {
+      case RenderCommandType::POLYGON:
+        return _numValuesPerVertex;
+      case RenderCommandType::TEXTURED_TRIANGLES:
+        return _numValuesPerTexturedVertex;
+      default:
+        return _numValuesPerColouredVertex;
+    }
+  }
+
+  bool _isRangeValid(int32_t offset, int64_t length, size_t arraySize)
+  {
+    return offset >= 0 && length >= 0
+           && static_cast<uint64_t>(offset) + static_cast<uint64_t>(length)
+              <= arraySize;
+  }
+  /////////////////////////////////////////////////
+
+  RenderCommandList::RenderCommandList()
+    : commands()
+    , vertexValues()
+    , indexes()
+    , rects()
+    , cameras()
+    , pixels()
+    , imGuiDrawLists()
+    , imGuiDrawListPtrs()
+    , imGuiDrawData()
+    , numMergedCommands(0)
+    , hasImGuiDrawData(false)
+    , isFrameCaptureNeeded(false) {}
+
+  void RenderCommandList::clear()
+  {
+    this->commands.clear();
+    this->vertexValues.clear();
+    this->indexes.clear();
+    this->rects.clear();
+    this->cameras.clear();
+    this->pixels.clear();
+    this->numMergedCommands = 0;
+    this->hasImGuiDrawData = false;
+    this->isFrameCaptureNeeded = false;
+  }
+
+  void RenderCommandList::addClear(SDL_Color colour)
+  {
+    RenderCommand command{};
+    command.type = RenderCommandType::CLEAR;
+    command.colour = colour;
+    this->commands.push_back(command);
+  }
+
+  void RenderCommandList::addSetCamera(const GPU_Camera& camera)
+  {
+    RenderCommand command{};
+    command.type = RenderCommandType::SET_CAMERA;
+    command.camera.cameraIndex = static_cast<int32_t>(this->cameras.size());
+    this->commands.push_back(command);
+
+    this->cameras.push_back(camera);
+  }
+
+  void RenderCommandList::addBlit(GPU_Image* image,
+                                  const GPU_Rect& srcRect,
+                                  const GPU_Rect& dstRect)
+  {
+    RenderCommand command{};
+    command.type = RenderCommandType::BLIT;
+    command.blit.image = image;
+    command.blit.rectIndex = static_cast<int32_t>(this->rects.size());
+    this->commands.push_back(command);
+
+    this->rects.push_back(srcRect);
+    this->rects.push_back(dstRect);
+  }
+
+  void RenderCommandList::addPolygon(const float* vertices,
+                                     int32_t numVertices,
+                                     SDL_Color colour,
+                                     bool isFilled)
+  {
+    if (isFilled) {
+      if (numVertices < 3 || numVertices > kMaxNumVertices) {
+        return;
+      }
+
+      // Fill the polygon as a triangle fan, so that it can be merged with the
+      // triangles around it.
+      RenderCommand command{};
+      command.type = RenderCommandType::TRIANGLES;
+      command.geometry.vertexValueOffset = this->vertexValues.size();
+      command.geometry.numVertices = numVertices;
+      command.geometry.indexOffset = this->indexes.size();
+      command.geometry.numIndexes = (numVertices - 2) * 3;
+      this->commands.push_back(command);
+
+      const float r = colour.r / 255.f;
+      const float g = colour.g / 255.f;
+      const float b = colour.b / 255.f;
+      const float a = colour.a / 255.f;
+      for (int32_t i = 0; i < numVertices; i++) {
+        this->vertexValues.push_back(vertices[i * _numValuesPerVertex]);
+        this->vertexValues.push_back(vertices[(i * _numValuesPerVertex) + 1]);
+        this->vertexValues.push_back(r);
+        this->vertexValues.push_back(g);
+        this->vertexValues.push_back(b);
+        this->vertexValues.push_back(a);
+      }
+
+      for (int32_t i = 1; i < numVertices - 1; i++) {
+        this->indexes.push_back(0);
+        this->indexes.push_back(static_cast<unsigned short>(i));
+        this->indexes.push_back(static_cast<unsigned short>(i + 1));
+      }
+
+      return;
+    }
+
+    RenderCommand command{};
+    command.type = RenderCommandType::POLYGON;
+    command.colour = colour;
+    command.geometry.vertexValueOffset = this->vertexValues.size();
+    command.geometry.numVertices = numVertices;
+    this->commands.push_back(command);
+
+    this->vertexValues.insert(this->vertexValues.end(),
+                              vertices,
+                              vertices + (numVertices * _numValuesPerVertex));
+  }
+
+  void RenderCommandList::addTriangles(const float* vertexValues,
+                                       int32_t numVertices,
+                                       const unsigned short* indexes,
+                                       int32_t numIndexes)
+  {
+    this->addIndexedVertices(RenderCommandType::TRIANGLES,
+                             vertexValues,
+                             numVertices,
+                             indexes,
+                             numIndexes);
+  }
+
+  void RenderCommandList::addLines(const float* vertexValues,
+                                   int32_t numVertices,
+                                   const unsigned short* indexes,
+                                   int32_t numIndexes)
+  {
+    this->addIndexedVertices(RenderCommandType::LINES,
+                             vertexValues,
+                             numVertices,
+                             indexes,
+                             numIndexes);
+  }
+
+  void RenderCommandList::addCircle(float x,
+                                    float y,
+                                    float radius,
+                                    SDL_Color colour)
+  {
+    RenderCommand command{};
+    command.type = RenderCommandType::CIRCLE;
+    command.colour = colour;
+    command.circle.x = x;
+    command.circle.y = y;
+    command.circle.radius = radius;
+    this->commands.push_back(command);
+  }
+
+  void RenderCommandList::addTexturedTriangles(GPU_Image* image,
+                                               const float* vertexValues,
+                                               int32_t numVertices,
+                                               const unsigned short* indexes,
+                                               int32_t numIndexes)
+  {
+    RenderCommand command{};
+    command.type = RenderCommandType::TEXTURED_TRIANGLES;
+    command.texturedGeometry.image = image;
+
+    RenderCommand::GeometryData& geometry = command.texturedGeometry.geometry;
+    geometry.vertexValueOffset = this->vertexValues.size();
+    geometry.numVertices = numVertices;
+    geometry.indexOffset = this->indexes.size();
+    geometry.numIndexes = numIndexes;
+    this->commands.push_back(command);
+
+    this->vertexValues.insert(
+      this->vertexValues.end(),
+      vertexValues,
+      vertexValues + (numVertices * _numValuesPerTexturedVertex));
+    this->indexes.insert(this->indexes.end(), indexes, indexes + numIndexes);
+  }
+
+  void RenderCommandList::addImageUpdate(GPU_Image* image,
+                                         const uint8_t* pixels,
+                                         int32_t numBytesPerRow)
+  {
+    RenderCommand command{};
+    command.type = RenderCommandType::UPDATE_IMAGE;
+    command.imageUpdate.image = image;
+    command.imageUpdate.pixelOffset = this->pixels.size();
+    command.imageUpdate.numBytesPerRow = numBytesPerRow;
+    command.imageUpdate.numRows = image->h;
+    this->commands.push_back(command);
+
+    this->pixels.insert(this->pixels.end(),
+                        pixels,
+                        pixels + (numBytesPerRow * image->h));
+  }
+
+  void RenderCommandList::mergeCommands()
+  {
+    if (this->commands.empty()) {
+      return;
+    }
+
+    // Compact the commands in place. Merged commands keep using the vertices
+    // and indexes they already have, since those are next to each other in
+    // the arrays. Only the indexes of the command being merged in need to be
+    // shifted past the vertices before them.
+    size_t lastIndex = 0;
+    for (size_t i = 1; i < this->commands.size(); i++) {
+      RenderCommand& lastCommand = this->commands[lastIndex];
+      const RenderCommand& command = this->commands[i];
+      if (this->canMergeCommands(lastCommand, command)) {
+        RenderCommand::GeometryData& lastGeometry = _getGeometry(lastCommand);
+        const RenderCommand::GeometryData& geometry = _getGeometry(command);
+        const auto indexBaseOffset = static_cast<unsigned short>(
+          lastGeometry.numVertices);
+        unsigned short* indexes = this->indexes.data() + geometry.indexOffset;
+        for (int32_t j = 0; j < geometry.numIndexes; j++) {
+          indexes[j] += indexBaseOffset;
+        }
+
+        lastGeometry.numVertices += geometry.numVertices;
+        lastGeometry.numIndexes += geometry.numIndexes;
+        this->numMergedCommands++;
+      } else {
+        lastIndex++;
+        this->commands[lastIndex] = command;
+      }
+    }
+
+    this->commands.resize(lastIndex + 1);
+  }
+
+  void RenderCommandList::setImGuiDrawData(const ImDrawData* drawData)
+  {
+    if (drawData == nullptr || !drawData->Valid) {
+      this->hasImGuiDrawData = false;
+      return;
+    }
+
+    const int32_t numDrawLists = drawData->CmdListsCount;
+    while (this->imGuiDrawLists.size() < numDrawLists) {
+      this->imGuiDrawLists.push_back(
+        eastl::make_unique<ImDrawList>(ImGui::GetDrawListSharedData()));
+    }
+
+    this->imGuiDrawListPtrs.resize(numDrawLists);
+    for (int32_t i = 0; i < numDrawLists; i++) {
+      const ImDrawList* srcDrawList = drawData->CmdLists[i];
+      ImDrawList* drawList = this->imGuiDrawLists[i].get();
+      _copyImVector(drawList->CmdBuffer, srcDrawList->CmdBuffer);
+      _copyImVector(drawList->IdxBuffer, srcDrawList->IdxBuffer);
+      _copyImVector(drawList->VtxBuffer, srcDrawList->VtxBuffer);
+      drawList->Flags = srcDrawList->Flags;
+
+      this->imGuiDrawListPtrs[i] = drawList;
+    }
+
+    this->imGuiDrawData = *drawData;
+    this->imGuiDrawData.CmdLists = this->imGuiDrawListPtrs.data();
+    this->hasImGuiDrawData = true;
+  }
+
+  ImDrawData* RenderCommandList::getImGuiDrawData()
+  {
+    return this->hasImGuiDrawData ? &(this->imGuiDrawData) : nullptr;
+  }
+
+  void RenderCommandList::setFrameCaptured(bool isFrameCaptured)
+  {
+    this->isFrameCaptureNeeded = isFrameCaptured;
+  }
+
+  bool RenderCommandList::isFrameCaptured() const
+  {
+    return this->isFrameCaptureNeeded;
+  }
+
+  void RenderCommandList::execute(RenderBackend& backend)
+  {
+    for (const RenderCommand& command : this->commands) {
+      switch (command.type) {
+        case RenderCommandType::CLEAR:
+          backend.clear(command.colour);
+          break;
+        case RenderCommandType::SET_CAMERA:
+          backend.setCamera(this->cameras[command.camera.cameraIndex]);
+          break;
+        case RenderCommandType::BLIT:
+          backend.blit(command.blit.image,
+                       this->rects[command.blit.rectIndex],
+                       this->rects[command.blit.rectIndex + 1]);
+          break;
+        case RenderCommandType::POLYGON:
+          backend.drawPolygon(
+            this->vertexValues.data() + command.geometry.vertexValueOffset,
+            command.geometry.numVertices,
+            command.colour);
+          break;
+        case RenderCommandType::TRIANGLES:
+          backend.drawTriangles(
+            this->vertexValues.data() + command.geometry.vertexValueOffset,
+            command.geometry.numVertices,
+            this->indexes.data() + command.geometry.indexOffset,
+            command.geometry.numIndexes);
+          break;
+        case RenderCommandType::LINES:
+          backend.drawLines(
+            this->vertexValues.data() + command.geometry.vertexValueOffset,
+            command.geometry.numVertices,
+            this->indexes.data() + command.geometry.indexOffset,
+            command.geometry.numIndexes);
+          break;
+        case RenderCommandType::CIRCLE:
+          backend.drawCircle(command.circle.x,
+                             command.circle.y,
+                             command.circle.radius,
+                             command.colour);
+          break;
+        case RenderCommandType::TEXTURED_TRIANGLES: {
+          const RenderCommand::GeometryData& geometry =
+            command.texturedGeometry.geometry;
+          backend.drawTexturedTriangles(
+            command.texturedGeometry.image,
+            this->vertexValues.data() + geometry.vertexValueOffset,
+            geometry.numVertices,
+            this->indexes.data() + geometry.indexOffset,
+            geometry.numIndexes);
+        } break;
+        case RenderCommandType::UPDATE_IMAGE:
+          backend.updateImage(
+            command.imageUpdate.image,
+            this->pixels.data() + command.imageUpdate.pixelOffset,
+            command.imageUpdate.numBytesPerRow);
+          break;
+      }
+    }
+  }
+
+  int32_t RenderCommandList::getNumCommands() const
+  {
+    return static_cast<int32_t>(this->commands.size());
+  }
+
+  int32_t RenderCommandList::getNumMergedCommands() const
+  {
+    return this->numMergedCommands;
+  }
+
+  int32_t RenderCommandList::findFirstDifference(
+    const RenderCommandList& other) const
+  {
+    const size_t numCommands = std::min(this->commands.size(),
+                                        other.commands.size());
+    for (size_t i = 0; i < numCommands; i++) {
+      if (!this->areCommandsEqual(this->commands[i],
+                                  other,
+                                  other.commands[i])) {
+        return static_cast<int32_t>(i);
+      }
+    }
+
+    if (this->commands.size() != other.commands.size()) {
+      return static_cast<int32_t>(numCommands);
+    }
+
+    return -1;
+  }
+
+  void RenderCommandList::write(std::ostream& stream) const
+  {
+    // Image pointers mean nothing outside of this run, so they don't get
+    // written. This also keeps recordings of the same frames byte for byte
+    // the same.
+    const int32_t numCommands = static_cast<int32_t>(this->commands.size());
+    stream.write(reinterpret_cast<const char*>(&numCommands),
+                 sizeof(numCommands));
+    for (const RenderCommand& command : this->commands) {
+      RenderCommand writtenCommand = command;
+      if (writtenCommand.type == RenderCommandType::BLIT) {
+        writtenCommand.blit.image = nullptr;
+      } else if (writtenCommand.type
+                 == RenderCommandType::TEXTURED_TRIANGLES) {
+        writtenCommand.texturedGeometry.image = nullptr;
+      } else if (writtenCommand.type == RenderCommandType::UPDATE_IMAGE) {
+        writtenCommand.imageUpdate.image = nullptr;
+      }
+
+      stream.write(reinterpret_cast<const char*>(&writtenCommand),
+                   sizeof(RenderCommand));
+    }
+
+    _writeArray(stream, this->vertexValues);
+    _writeArray(stream, this->indexes);
+    _writeArray(stream, this->rects);
+    _writeArray(stream, this->cameras);
+    _writeArray(stream, this->pixels);
+  }
+
+  bool RenderCommandList::read(std::istream& stream)
+  {
+    this->clear();
+
+    if (!_readArray(stream, this->commands)
+        || !_readArray(stream, this->vertexValues)
+        || !_readArray(stream, this->indexes)
+        || !_readArray(stream, this->rects)
+        || !_readArray(stream, this->cameras)
+        || !_readArray(stream, this->pixels)) {
+      this->clear();
+      return false;
+    }
+
+    // Make sure a bad file can't make us read past the data we have.
+    for (RenderCommand& command : this->commands) {
+      bool isCommandValid = true;
+      switch (command.type) {
+        case RenderCommandType::CLEAR:
+        case RenderCommandType::CIRCLE:
+          break;
+        case RenderCommandType::SET_CAMERA:
+          isCommandValid = _isRangeValid(command.camera.cameraIndex,
+                                         1,
+                                         this->cameras.size());
+          break;
+        case RenderCommandType::BLIT:
+          // Images aren't recorded, so whatever is in the file is garbage.
+          command.blit.image = nullptr;
+          isCommandValid = _isRangeValid(command.blit.rectIndex,
+                                         2,
+                                         this->rects.size());
+          break;
+        case RenderCommandType::POLYGON:
+        case RenderCommandType::TRIANGLES:
+        case RenderCommandType::LINES:
+        case RenderCommandType::TEXTURED_TRIANGLES: {
+          if (command.type == RenderCommandType::TEXTURED_TRIANGLES) {
+            command.texturedGeometry.image = nullptr;
+          }
+
+          const RenderCommand::GeometryData& geometry = _getGeometry(command);
+          isCommandValid =
+            geometry.numVertices <= kMaxNumVertices
+            && _isRangeValid(
+                 geometry.vertexValueOffset,
+                 geometry.numVertices * _getNumValuesPerVertex(command.type),
+                 this->vertexValues.size())
+            && _isRangeValid(geometry.indexOffset,
+                             geometry.numIndexes,
+                             this->indexes.size());
+        } break;
+        case RenderCommandType::UPDATE_IMAGE: {
+          command.imageUpdate.image = nullptr;
+
+          const RenderCommand::ImageUpdateData& imageUpdate =
+            command.imageUpdate;
+          isCommandValid =
+            imageUpdate.numRows >= 0
+            && _isRangeValid(imageUpdate.pixelOffset,
+                             static_cast<int64_t>(imageUpdate.numBytesPerRow)
+                               * imageUpdate.numRows,
+                             this->pixels.size());
+        } break;
+        default:
+          isCommandValid = false;
+          break;
+      }
+
+      if (!isCommandValid) {
+        this->clear();
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  void RenderCommandList::addIndexedVertices(RenderCommandType type,
+                                             const float* vertexValues,
+                                             int32_t numVertices,
+                                             const unsigned short* indexes,
+                                             int32_t numIndexes)
+  {
+    RenderCommand command{};
+    command.type = type;
+    command.geometry.vertexValueOffset = this->vertexValues.size();
+    command.geometry.numVertices = numVertices;
+    command.geometry.indexOffset = this->indexes.size();
+    command.geometry.numIndexes = numIndexes;
+    this->commands.push_back(command);
+
+    this->vertexValues.insert(
+      this->vertexValues.end(),
+      vertexValues,
+      vertexValues + (numVertices * _numValuesPerColouredVertex));
+    this->indexes.insert(this->indexes.end(), indexes, indexes + numIndexes);
+  }
+
+  bool RenderCommandList::canMergeCommands(
+    const RenderCommand& command,
+    const RenderCommand& nextCommand) const
+  {
+    if (command.type != nextCommand.type
+        || (command.type != RenderCommandType::TRIANGLES
+            && command.type != RenderCommandType::LINES
+            && command.type != RenderCommandType::TEXTURED_TRIANGLES)) {
+      return false;
+    }
+
+    if (command.type == RenderCommandType::TEXTURED_TRIANGLES
+        && command.texturedGeometry.image
+           != nextCommand.texturedGeometry.image) {
+      return false;
+    }
+
+    const RenderCommand::GeometryData& geometry = _getGeometry(command);
+    const RenderCommand::GeometryData& nextGeometry =
+      _getGeometry(nextCommand);
+    const bool areVerticesContiguous =
+      nextGeometry.vertexValueOffset
+        == geometry.vertexValueOffset
+           + (geometry.numVertices * _getNumValuesPerVertex(command.type));
+    const bool areIndexesContiguous =
+      nextGeometry.indexOffset == geometry.indexOffset + geometry.numIndexes;
+
+    return areVerticesContiguous
+           && areIndexesContiguous
+           && geometry.numVertices + nextGeometry.numVertices
+              <= kMaxNumVertices;
+  }
+
+  bool RenderCommandList::areCommandsEqual(
+    const RenderCommand& command,
+    const RenderCommandList& otherList,
+    const RenderCommand& otherCommand) const
+  {
+    if (command.type != otherCommand.type
+        || !areColoursEqual(command.colour, otherCommand.colour)) {
+      return false;
+    }
+
+    switch (command.type) {
+      case RenderCommandType::CLEAR:
+        return true;
+      case RenderCommandType::SET_CAMERA:
+        return _areCamerasEqual(
+          this->cameras[command.camera.cameraIndex],
+          otherList.cameras[otherCommand.camera.cameraIndex]);
+      case RenderCommandType::BLIT: {
+        const GPU_Rect* rects = this->rects.data() + command.blit.rectIndex;
+        const GPU_Rect* otherRects = otherList.rects.data()
+                                     + otherCommand.blit.rectIndex;
+        return _areRectsEqual(rects[0], otherRects[0])
+               && _areRectsEqual(rects[1], otherRects[1]);
+      }
+      case RenderCommandType::POLYGON:
+      case RenderCommandType::TRIANGLES:
+      case RenderCommandType::LINES:
+      case RenderCommandType::TEXTURED_TRIANGLES: {
+        const RenderCommand::GeometryData& geometry = _getGeometry(command);
+        const RenderCommand::GeometryData& otherGeometry =
+          _getGeometry(otherCommand);
+        if (geometry.numVertices != otherGeometry.numVertices
+            || geometry.numIndexes != otherGeometry.numIndexes) {
+          return false;
+        }
+
+        const int32_t numValuesPerVertex = _getNumValuesPerVertex(
+          command.type);
+        const float* vertexValues = this->vertexValues.data()
+                                    + geometry.vertexValueOffset;
+        const float* otherVertexValues = otherList.vertexValues.data()
+                                         + otherGeometry.vertexValueOffset;
+        const unsigned short* indexes = this->indexes.data()
+                                        + geometry.indexOffset;
+        const unsigned short* otherIndexes = otherList.indexes.data()
+                                             + otherGeometry.indexOffset;
+        return std::equal(vertexValues,
+                          vertexValues
+                            + (geometry.numVertices * numValuesPerVertex),
+                          otherVertexValues)
+               && std::equal(indexes,
+                             indexes + geometry.numIndexes,
+                             otherIndexes);
+      }
+      case RenderCommandType::CIRCLE:
+        return command.circle.x == otherCommand.circle.x
+               && command.circle.y == otherCommand.circle.y
+               && command.circle.radius == otherCommand.circle.radius;
+      case RenderCommandType::UPDATE_IMAGE: {
+        const RenderCommand::ImageUpdateData& imageUpdate =
+          command.imageUpdate;
+        const RenderCommand::ImageUpdateData& otherImageUpdate =
+          otherCommand.imageUpdate;
+        if (imageUpdate.numBytesPerRow != otherImageUpdate.numBytesPerRow
+            || imageUpdate.numRows != otherImageUpdate.numRows) {
+          return false;
+        }
+
+        const uint8_t* pixels = this->pixels.data()
+                                + imageUpdate.pixelOffset;
+        const uint8_t* otherPixels = otherList.pixels.data()
+                                     + otherImageUpdate.pixelOffset;
+        return std::equal(
+          pixels,
+          pixels + (imageUpdate.numBytesPerRow * imageUpdate.numRows),
+          otherPixels);
+      }
+    }
+
+    return false;
+  }
+}
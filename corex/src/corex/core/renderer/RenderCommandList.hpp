@@ -0,0 +1,146 @@
+#ifndef COREX_CORE_RENDERER_RENDER_COMMAND_LIST_HPP
+#define COREX_CORE_RENDERER_RENDER_COMMAND_LIST_HPP
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+#include <imgui.h>
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderBackend.hpp>
+#include <corex/core/renderer/RenderCommand.hpp>
+
+namespace corex::core
+{
+  // Everything needed to draw a frame, recorded ahead of time and executed
+  // later by a RenderBackend. The list owns copies of all vertex data and of
+  // ImGui's draw data, so the registry and ImGui can move on to the next frame
+  // while the list gets executed. Images are referenced, not copied, so they
+  // must outlive the list's execution (see GPUContextLock). Pixels for image
+  // updates are copied too.
+  //
+  // Commands are small PODs, and their data is kept in a handful of flat
+  // arrays. Clearing a list keeps its memory around, so recording a frame
+  // doesn't allocate once the list has grown to fit.
+  class RenderCommandList
+  {
+  public:
+    RenderCommandList();
+
+    RenderCommandList(const RenderCommandList&) = delete;
+    RenderCommandList& operator=(const RenderCommandList&) = delete;
+
+    void clear();
+
+    void addClear(SDL_Color colour);
+    void addSetCamera(const GPU_Camera& camera);
+    void addBlit(GPU_Image* image,
+                 const GPU_Rect& srcRect,
+                 const GPU_Rect& dstRect);
+
+    // Vertices are x, y pairs. Filled polygons are assumed to be convex, and
+    // are turned into triangle fans.
+    void addPolygon(const float* vertices,
+                    int32_t numVertices,
+                    SDL_Color colour,
+                    bool isFilled);
+
+    // Vertices are x, y, r, g, b, a, with colours from 0 to 1.
+    void addTriangles(const float* vertexValues,
+                      int32_t numVertices,
+                      const unsigned short* indexes,
+                      int32_t numIndexes);
+    void addLines(const float* vertexValues,
+                  int32_t numVertices,
+                  const unsigned short* indexes,
+                  int32_t numIndexes);
+    void addCircle(float x, float y, float radius, SDL_Color colour);
+
+    // Vertices are x, y, s, t, r, g, b, a, with texture coordinates and colours
+    // from 0 to 1.
+    void addTexturedTriangles(GPU_Image* image,
+                              const float* vertexValues,
+                              int32_t numVertices,
+                              const unsigned short* indexes,
+                              int32_t numIndexes);
+
+    // Replaces all the pixels of the image when the list gets executed, so
+    // that the upload happens wherever the GPU context is. The image's rows
+    // must be numBytesPerRow bytes long.
+    void addImageUpdate(GPU_Image* image,
+                        const uint8_t* pixels,
+                        int32_t numBytesPerRow);
+
+    // Merges runs of TRIANGLES commands, runs of LINES commands, and runs of
+    // TEXTURED_TRIANGLES commands with the same image, into as few commands as
+    // the vertex limit allows. Call it once recording is done.
+    void mergeCommands();
+
+    // Copies the draw data from ImGui::GetDrawData().
+    void setImGuiDrawData(const ImDrawData* drawData);
+    ImDrawData* getImGuiDrawData();
+
+    // Whether the frame should be captured after the commands are executed,
+    // and before ImGui is drawn.
+    void setFrameCaptured(bool isFrameCaptured);
+    bool isFrameCaptured() const;
+
+    void execute(RenderBackend& backend);
+    int32_t getNumCommands() const;
+    int32_t getNumMergedCommands() const;
+
+    // Returns the index of the first command that differs between the two
+    // lists, or -1 if they are the same. Commands are compared by what they
+    // draw, not by where their data is stored. Images are not compared, since
+    // lists read back from a file don't have them.
+    int32_t findFirstDifference(const RenderCommandList& other) const;
+
+    // Writes and reads the commands and their data, but not the images and
+    // ImGui's draw data. Blits, textured triangles, and image updates that are
+    // read back have null images, which backends skip, so text and sprites
+    // don't get replayed. Reading replaces everything in the list, and leaves
+    // it empty if the data is truncated or corrupted.
+    void write(std::ostream& stream) const;
+    bool read(std::istream& stream);
+
+  private:
+    // Indexes are unsigned shorts, so a single command can't have more
+    // vertices than this.
+    static constexpr int32_t kMaxNumVertices = 65535;
+
+    eastl::vector<RenderCommand> commands;
+    eastl::vector<float> vertexValues;
+    eastl::vector<unsigned short> indexes;
+    eastl::vector<GPU_Rect> rects;
+    eastl::vector<GPU_Camera> cameras;
+    eastl::vector<uint8_t> pixels;
+    eastl::vector<eastl::unique_ptr<ImDrawList>> imGuiDrawLists;
+    eastl::vector<ImDrawList*> imGuiDrawListPtrs;
+    ImDrawData imGuiDrawData;
+    int32_t numMergedCommands;
+    bool hasImGuiDrawData;
+    bool isFrameCaptureNeeded;
+
+    void addIndexedVertices(RenderCommandType type,
+                            const float* vertexValues,
+                            int32_t numVertices,
+                            const unsigned short* indexes,
+                            int32_t numIndexes);
+    bool canMergeCommands(const RenderCommand& command,
+                          const RenderCommand& nextCommand) const;
+    bool areCommandsEqual(const RenderCommand& command,
+                          const RenderCommandList& otherList,
+                          const RenderCommand& otherCommand) const;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
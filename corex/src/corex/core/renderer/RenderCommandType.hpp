@@ -0,0 +1,21 @@
+#ifndef COREX_CORE_RENDERER_RENDER_COMMAND_TYPE_HPP
+#define COREX_CORE_RENDERER_RENDER_COMMAND_TYPE_HPP
+
+#include <cstdint>
+
+namespace corex::core
+{
+  // Stored in a byte to keep render commands small.
+  enum class RenderCommandType : uint8_t
+  {
+    CLEAR, SET_CAMERA, BLIT, POLYGON, TRIANGLES, LINES, CIRCLE,
+    TEXTURED_TRIANGLES, UPDATE_IMAGE
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -0,0 +1,280 @@
+#include <cstdint>
+#include <cstring>
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/components/Position.hpp>
+#include <corex/core/components/Renderable.hpp>
+#include <corex/core/components/RenderableType.hpp>
+#include <corex/core/components/RenderCircle.hpp>
+#include <corex/core/components/RenderGeometryCache.hpp>
+#include <corex/core/components/RenderImage.hpp>
+#include <corex/core/components/Sprite.hpp>
+#include <corex/core/components/Text.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/RenderQueue.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  constexpr int32_t _numKeyDigits = 8;
+  constexpr int32_t _numDigitValues = 256;
+
+  // Maps a float to an unsigned integer that sorts in the same order as the
+  // float. Positive floats get their sign bit set, and negative floats get all
+  // of their bits flipped so that more negative values come first.
+  uint32_t _getOrderedFloatBits(float value)
+  {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+  }
+
+  uint32_t _getTextureHash(const void* texture)
+  {
+    // Fibonacci hashing. Only the top 20 bits are used.
+    const auto address = reinterpret_cast<uintptr_t>(texture);
+    return static_cast<uint32_t>(
+      (static_cast<uint64_t>(address) * 0x9E3779B97F4A7C15ull) >> 44);
+  }
+  /////////////////////////////////////////////////
+
+  RenderQueue::RenderQueue(entt::registry& registry)
+    : registry(registry)
+    , items()
+    , scratchItems()
+    , visibleItems()
+    , isRebuildNeeded(true)
+  {
+    this->registry.on_construct<Position>()
+                  .connect<&RenderQueue::handleRenderableChanges>(this);
+    this->registry.on_destroy<Position>()
+                  .connect<&RenderQueue::handleRenderableChanges>(this);
+    this->registry.on_construct<Renderable>()
+                  .connect<&RenderQueue::handleRenderableChanges>(this);
+    this->registry.on_destroy<Renderable>()
+                  .connect<&RenderQueue::handleRenderableChanges>(this);
+  }
+
+  RenderQueue::~RenderQueue()
+  {
+    this->registry.on_construct<Position>()
+                  .disconnect<&RenderQueue::handleRenderableChanges>(this);
+    this->registry.on_destroy<Position>()
+                  .disconnect<&RenderQueue::handleRenderableChanges>(this);
+    this->registry.on_construct<Renderable>()
+                  .disconnect<&RenderQueue::handleRenderableChanges>(this);
+    this->registry.on_destroy<Renderable>()
+                  .disconnect<&RenderQueue::handleRenderableChanges>(this);
+  }
+
+  const eastl::vector<RenderQueue::Item>& RenderQueue::update(
+    const AABB& viewBounds)
+  {
+    bool areItemsSorted = true;
+    if (this->isRebuildNeeded) {
+      this->rebuildItems();
+      areItemsSorted = false;
+    } else {
+      areItemsSorted = this->updateItemKeys();
+    }
+
+    if (!areItemsSorted) {
+      this->sortItems();
+    }
+
+    this->cullItems(viewBounds);
+
+    return this->visibleItems;
+  }
+
+  int32_t RenderQueue::size() const
+  {
+    return static_cast<int32_t>(this->items.size());
+  }
+
+  int32_t RenderQueue::getNumVisibleItems() const
+  {
+    return static_cast<int32_t>(this->visibleItems.size());
+  }
+
+  void RenderQueue::handleRenderableChanges(entt::registry& registry,
+                                            entt::entity entity)
+  {
+    // Destruction signals are fired before the component gets removed, so we
+    // can't rebuild here. Defer it to the next update instead.
+    this->isRebuildNeeded = true;
+  }
+
+  void RenderQueue::rebuildItems()
+  {
+    this->items.clear();
+
+    auto renderables = this->registry.view<Position, Renderable>();
+    for (entt::entity e : renderables) {
+      this->items.push_back(Item{ this->computeSortKey(e), e });
+    }
+
+    this->isRebuildNeeded = false;
+  }
+
+  bool RenderQueue::updateItemKeys()
+  {
+    // Returns true if the items are still sorted with their new keys.
+    bool areItemsSorted = true;
+    uint64_t prevKey = 0;
+    for (Item& item : this->items) {
+      item.key = this->computeSortKey(item.entity);
+      areItemsSorted = areItemsSorted && (prevKey <= item.key);
+      prevKey = item.key;
+    }
+
+    return areItemsSorted;
+  }
+
+  void RenderQueue::sortItems()
+  {
+    // LSD radix sort with 8-bit digits. The histograms of all digits are
+    // built in a single pass, and digits that are the same for every item
+    // (e.g. the sorting layer when everything is in one layer) are skipped.
+    const int32_t numItems = static_cast<int32_t>(this->items.size());
+    if (numItems < 2) {
+      return;
+    }
+
+    eastl::array<eastl::array<int32_t, _numDigitValues>, _numKeyDigits>
+      digitCounts{};
+    for (const Item& item : this->items) {
+      for (int32_t digit = 0; digit < _numKeyDigits; digit++) {
+        digitCounts[digit][(item.key >> (digit * 8)) & 0xFF]++;
+      }
+    }
+
+    this->scratchItems.resize(this->items.size());
+    Item* srcItems = this->items.data();
+    Item* dstItems = this->scratchItems.data();
+    for (int32_t digit = 0; digit < _numKeyDigits; digit++) {
+      eastl::array<int32_t, _numDigitValues>& counts = digitCounts[digit];
+      const uint32_t firstDigitValue = (srcItems[0].key >> (digit * 8)) & 0xFF;
+      if (counts[firstDigitValue] == numItems) {
+        continue;
+      }
+
+      // Turn the counts into starting offsets.
+      int32_t offset = 0;
+      for (int32_t& count : counts) {
+        const int32_t numItemsWithValue = count;
+        count = offset;
+        offset += numItemsWithValue;
+      }
+
+      for (int32_t i = 0; i < numItems; i++) {
+        const uint32_t digitValue = (srcItems[i].key >> (digit * 8)) & 0xFF;
+        dstItems[counts[digitValue]++] = srcItems[i];
+      }
+
+      Item* tmpItems = srcItems;
+      srcItems = dstItems;
+      dstItems = tmpItems;
+    }
+
+    if (srcItems != this->items.data()) {
+      this->items.swap(this->scratchItems);
+    }
+  }
+
+  void RenderQueue::cullItems(const AABB& viewBounds)
+  {
+    this->visibleItems.clear();
+    for (const Item& item : this->items) {
+      if (this->isEntityVisible(item.entity, viewBounds)) {
+        this->visibleItems.push_back(item);
+      }
+    }
+  }
+
+  bool RenderQueue::isEntityVisible(entt::entity entity,
+                                    const AABB& viewBounds) const
+  {
+    const Position& pos = this->registry.get<Position>(entity);
+    const Renderable& renderable = this->registry.get<Renderable>(entity);
+    if (!renderable.isVisible) {
+      return false;
+    }
+
+    Point halfExtents{ 0.f, 0.f };
+    switch (renderable.type) {
+      case RenderableType::TEXT: {
+        const Text& text = this->registry.get<Text>(entity);
+        halfExtents = Point{ text.getWidth() / 2.f, text.getHeight() / 2.f };
+      } break;
+      case RenderableType::SPRITE: {
+        const Sprite& sprite = this->registry.get<Sprite>(entity);
+        halfExtents = Point{ sprite.width / 2.f, sprite.height / 2.f };
+      } break;
+      case RenderableType::PRIMITIVE_RECTANGLE:
+      case RenderableType::PRIMITIVE_POLYGON: {
+        // The bounds are computed whenever the geometry gets rebuilt.
+        const auto& geometry = this->registry.get<RenderGeometryCache>(entity);
+        return areTwoAABBsIntersecting(geometry.bounds, viewBounds);
+      }
+      case RenderableType::LINE_SEGMENTS:
+        // Line segments are drawn in batches that span many entities, so we
+        // don't cull them individually.
+        return true;
+      case RenderableType::POINT_CLOUD:
+        // Point clouds are culled point by point when they get recorded.
+        return true;
+      case RenderableType::PRIMITIVE_CIRCLE: {
+        const float radius = this->registry.get<RenderCircle>(entity).radius;
+        halfExtents = Point{ radius, radius };
+      } break;
+      case RenderableType::IMAGE: {
+        const RenderImage& image = this->registry.get<RenderImage>(entity);
+        halfExtents = Point{ image.width / 2.f, image.height / 2.f };
+      } break;
+    }
+
+    const AABB bounds{
+      Point{ pos.x - halfExtents.x, pos.y - halfExtents.y },
+      Point{ pos.x + halfExtents.x, pos.y + halfExtents.y }
+    };
+    return areTwoAABBsIntersecting(bounds, viewBounds);
+  }
+
+  uint64_t RenderQueue::computeSortKey(entt::entity entity) const
+  {
+    const Position& pos = this->registry.get<Position>(entity);
+    const Renderable& renderable = this->registry.get<Renderable>(entity);
+
+    const void* texture = nullptr;
+    switch (renderable.type) {
+      case RenderableType::TEXT:
+        texture = this->registry.get<Text>(entity).getAtlasImage();
+        break;
+      case RenderableType::SPRITE:
+        texture = this->registry.get<Sprite>(entity).texture.get();
+        break;
+      case RenderableType::IMAGE:
+        texture = this->registry.get<RenderImage>(entity).image.get();
+        break;
+      default:
+        break;
+    }
+
+    // Flip the sign bit of the layer so that negative layers come first.
+    const uint64_t layerBits = static_cast<uint8_t>(pos.sortingLayerID) ^ 0x80u;
+    const uint64_t zBits = _getOrderedFloatBits(pos.z);
+    const uint64_t typeBits = static_cast<uint64_t>(renderable.type) & 0xFu;
+    const uint64_t textureBits = (texture == nullptr)
+                                 ? 0
+                                 : _getTextureHash(texture);
+
+    return (layerBits << 56) | (zBits << 24) | (typeBits << 20) | textureBits;
+  }
+}
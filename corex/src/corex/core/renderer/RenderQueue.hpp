@@ -0,0 +1,74 @@
+#ifndef COREX_CORE_RENDERER_RENDER_QUEUE_HPP
+#define COREX_CORE_RENDERER_RENDER_QUEUE_HPP
+
+#include <cstdint>
+
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+
+#include <corex/core/ds/AABB.hpp>
+
+namespace corex::core
+{
+  // Keeps the renderable entities (entities with a Position and a Renderable)
+  // sorted in draw order. Each entity gets a packed 64-bit sort key made up
+  // of, from the most significant bits down, its sorting layer (8 bits), its
+  // z (32 bits), its renderable type (4 bits), and a hash of its texture (20
+  // bits). Entities in the same layer and z that share a texture end up next
+  // to each other, which keeps texture switches down.
+  //
+  // Positions are written directly by scenes and systems, so no signal tells
+  // us when one changes. Instead, keys are recomputed every update, which is a
+  // single O(n) pass. The queue is only re-sorted, using a radix sort, when
+  // the recomputed keys are out of order. The entity list itself is only
+  // rebuilt when a Position or Renderable gets added or removed.
+  //
+  // Hidden entities, and entities whose bounds are outside the view of the
+  // camera, are culled after sorting. Culling doesn't change the order of the
+  // remaining entities, so panning and zooming the camera, or hiding and
+  // showing entities, never causes a re-sort.
+  class RenderQueue
+  {
+  public:
+    struct Item
+    {
+      uint64_t key;
+      entt::entity entity;
+    };
+
+    explicit RenderQueue(entt::registry& registry);
+    ~RenderQueue();
+
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    // Returns the renderable entities within the view bounds, sorted in draw
+    // order. The returned items are only valid until the next update.
+    const eastl::vector<Item>& update(const AABB& viewBounds);
+    int32_t size() const;
+    int32_t getNumVisibleItems() const;
+
+  private:
+    entt::registry& registry;
+    eastl::vector<Item> items;
+    eastl::vector<Item> scratchItems; // Used by the radix sort.
+    eastl::vector<Item> visibleItems;
+    bool isRebuildNeeded;
+
+    void handleRenderableChanges(entt::registry& registry,
+                                 entt::entity entity);
+    void rebuildItems();
+    bool updateItemKeys();
+    void sortItems();
+    void cullItems(const AABB& viewBounds);
+    bool isEntityVisible(entt::entity entity, const AABB& viewBounds) const;
+    uint64_t computeSortKey(entt::entity entity) const;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
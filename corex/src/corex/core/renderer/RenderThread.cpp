@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+#include <EASTL/unique_ptr.h>
+#include <SDL2/SDL.h>
+
+#include <corex/core/renderer/GPUContextLock.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+#include <corex/core/renderer/RenderThread.hpp>
+
+namespace corex::core
+{
+  RenderThread::RenderThread(SDL_Window* window,
+                             SDL_GLContext glContext,
+                             int32_t pipelineDepth,
+                             FrameExecutor frameExecutor)
+    : window(window)
+    , glContext(glContext)
+    , pipelineDepth(std::clamp(pipelineDepth,
+                               kMinPipelineDepth,
+                               kMaxPipelineDepth))
+    , frameExecutor(frameExecutor)
+    , commandLists()
+    , freeCommandLists()
+    , submittedCommandLists()
+    , thread()
+    , queueMutex()
+    , queueCondition()
+    , isExecutingFrame(false)
+    , isStopping(false)
+    , isThreadRunning(false)
+  {
+    // One list for each frame in the pipeline, plus the one being recorded.
+    for (int32_t i = 0; i < this->pipelineDepth + 1; i++) {
+      this->commandLists.push_back(eastl::make_unique<RenderCommandList>());
+      this->freeCommandLists.push_back(this->commandLists.back().get());
+    }
+  }
+
+  RenderThread::~RenderThread()
+  {
+    this->stop();
+  }
+
+  void RenderThread::start()
+  {
+    if (this->isThreadRunning) {
+      return;
+    }
+
+    // A context can only be current on one thread at a time.
+    SDL_GL_MakeCurrent(this->window, nullptr);
+
+    this->isStopping = false;
+    this->isThreadRunning = true;
+    this->thread = std::thread(&RenderThread::run, this);
+    setActiveRenderThread(this);
+
+    std::cout << "Rendering on a separate thread, with a pipeline depth of "
+              << this->pipelineDepth << "." << std::endl;
+  }
+
+  void RenderThread::stop()
+  {
+    if (!this->isThreadRunning) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(this->queueMutex);
+      this->isStopping = true;
+    }
+
+    this->queueCondition.notify_all();
+    this->thread.join();
+    this->isThreadRunning = false;
+    setActiveRenderThread(nullptr);
+
+    SDL_GL_MakeCurrent(this->window, this->glContext);
+  }
+
+  RenderCommandList& RenderThread::beginFrame()
+  {
+    std::unique_lock<std::mutex> lock(this->queueMutex);
+    this->queueCondition.wait(lock, [this]() {
+      return !this->freeCommandLists.empty();
+    });
+
+    RenderCommandList* commandList = this->freeCommandLists.front();
+    this->freeCommandLists.pop_front();
+    commandList->clear();
+
+    return *commandList;
+  }
+
+  void RenderThread::submitFrame(RenderCommandList& commandList)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->queueMutex);
+      this->submittedCommandLists.push_back(&commandList);
+    }
+
+    this->queueCondition.notify_all();
+  }
+
+  void RenderThread::acquireContext()
+  {
+    // Only the thread that submits frames acquires the context, so nothing
+    // new gets submitted while we hold it.
+    std::unique_lock<std::mutex> lock(this->queueMutex);
+    this->queueCondition.wait(lock, [this]() {
+      return this->submittedCommandLists.empty() && !this->isExecutingFrame;
+    });
+
+    SDL_GL_MakeCurrent(this->window, this->glContext);
+  }
+
+  void RenderThread::releaseContext()
+  {
+    SDL_GL_MakeCurrent(this->window, nullptr);
+  }
+
+  bool RenderThread::isCurrentThread() const
+  {
+    return std::this_thread::get_id() == this->thread.get_id();
+  }
+
+  int32_t RenderThread::getPipelineDepth() const
+  {
+    return this->pipelineDepth;
+  }
+
+  void RenderThread::run()
+  {
+    while (true) {
+      RenderCommandList* commandList = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(this->queueMutex);
+        this->queueCondition.wait(lock, [this]() {
+          return !this->submittedCommandLists.empty() || this->isStopping;
+        });
+
+        if (this->submittedCommandLists.empty()) {
+          break;
+        }
+
+        commandList = this->submittedCommandLists.front();
+        this->submittedCommandLists.pop_front();
+        this->isExecutingFrame = true;
+      }
+
+      // The context is only held while executing a frame, so that it can be
+      // acquired by other threads in between frames.
+      SDL_GL_MakeCurrent(this->window, this->glContext);
+      this->frameExecutor(*commandList);
+      SDL_GL_MakeCurrent(this->window, nullptr);
+
+      {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        this->freeCommandLists.push_back(commandList);
+        this->isExecutingFrame = false;
+      }
+
+      this->queueCondition.notify_all();
+    }
+  }
+}
@@ -0,0 +1,89 @@
+#ifndef COREX_CORE_RENDERER_RENDER_THREAD_HPP
+#define COREX_CORE_RENDERER_RENDER_THREAD_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <EASTL/deque.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+#include <SDL2/SDL.h>
+
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace corex::core
+{
+  // Executes recorded frames on a thread of its own, so that the next frame
+  // can be updated and recorded while the previous one gets drawn.
+  //
+  // The OpenGL context belongs to the render thread while it runs. Anything
+  // else that needs the context has to go through a GPUContextLock.
+  //
+  // The pipeline depth is the number of frames that can be waiting for, or
+  // going through, execution at the same time. A depth of 1 is plain double
+  // buffering, where recording a frame overlaps with drawing the previous
+  // one. Deeper pipelines smooth out uneven frames, but each extra frame adds
+  // a frame of latency between input and what is on screen. Once the pipeline
+  // is full, beginFrame() blocks until the render thread catches up.
+  class RenderThread
+  {
+  public:
+    using FrameExecutor = entt::delegate<void(RenderCommandList&)>;
+
+    static constexpr int32_t kMinPipelineDepth = 1;
+    static constexpr int32_t kMaxPipelineDepth = 3;
+
+    RenderThread(SDL_Window* window,
+                 SDL_GLContext glContext,
+                 int32_t pipelineDepth,
+                 FrameExecutor frameExecutor);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // Must be called from the thread the OpenGL context is current on. The
+    // context gets handed over to the render thread, and is handed back once
+    // the render thread is stopped.
+    void start();
+
+    // Executes the frames that have been submitted before stopping.
+    void stop();
+
+    // Returns an empty command list to record the next frame into.
+    RenderCommandList& beginFrame();
+    void submitFrame(RenderCommandList& commandList);
+
+    void acquireContext();
+    void releaseContext();
+    bool isCurrentThread() const;
+    int32_t getPipelineDepth() const;
+
+  private:
+    SDL_Window* window;
+    SDL_GLContext glContext;
+    int32_t pipelineDepth;
+    FrameExecutor frameExecutor;
+    eastl::vector<eastl::unique_ptr<RenderCommandList>> commandLists;
+    eastl::deque<RenderCommandList*> freeCommandLists;
+    eastl::deque<RenderCommandList*> submittedCommandLists;
+    std::thread thread;
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    bool isExecutingFrame;
+    bool isStopping;
+    bool isThreadRunning;
+
+    void run();
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
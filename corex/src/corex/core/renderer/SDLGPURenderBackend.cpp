@@ -0,0 +1,115 @@
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderBackend.hpp>
+#include <corex/core/renderer/SDLGPURenderBackend.hpp>
+
+namespace corex::core
+{
+  SDLGPURenderBackend::SDLGPURenderBackend(GPU_Target* target)
+    : target(target) {}
+
+  void SDLGPURenderBackend::clear(SDL_Color colour)
+  {
+    GPU_ClearRGBA(this->target, colour.r, colour.g, colour.b, colour.a);
+  }
+
+  void SDLGPURenderBackend::setCamera(const GPU_Camera& camera)
+  {
+    // SDL_gpu copies the camera, so it's fine to hand it a temporary.
+    GPU_Camera cameraCopy = camera;
+    GPU_SetCamera(this->target, &cameraCopy);
+  }
+
+  void SDLGPURenderBackend::blit(GPU_Image* image,
+                                 const GPU_Rect& srcRect,
+                                 const GPU_Rect& dstRect)
+  {
+    if (image == nullptr) {
+      // There's nothing to draw for blits in frames read back from a file.
+      return;
+    }
+
+    GPU_Rect src = srcRect;
+    GPU_Rect dst = dstRect;
+    GPU_BlitRect(image, &src, this->target, &dst);
+  }
+
+  void SDLGPURenderBackend::drawPolygon(float* vertices,
+                                        int32_t numVertices,
+                                        SDL_Color colour)
+  {
+    GPU_Polygon(this->target, numVertices, vertices, colour);
+  }
+
+  void SDLGPURenderBackend::drawTriangles(float* vertexValues,
+                                          int32_t numVertices,
+                                          unsigned short* indexes,
+                                          int32_t numIndexes)
+  {
+    GPU_TriangleBatch(nullptr,
+                      this->target,
+                      static_cast<unsigned short>(numVertices),
+                      vertexValues,
+                      static_cast<unsigned int>(numIndexes),
+                      indexes,
+                      GPU_BATCH_XY_RGBA);
+  }
+
+  void SDLGPURenderBackend::drawLines(float* vertexValues,
+                                      int32_t numVertices,
+                                      unsigned short* indexes,
+                                      int32_t numIndexes)
+  {
+    GPU_PrimitiveBatch(nullptr,
+                       this->target,
+                       GPU_LINES,
+                       static_cast<unsigned short>(numVertices),
+                       vertexValues,
+                       static_cast<unsigned int>(numIndexes),
+                       indexes,
+                       GPU_BATCH_XY_RGBA);
+  }
+
+  void SDLGPURenderBackend::drawCircle(float x,
+                                       float y,
+                                       float radius,
+                                       SDL_Color colour)
+  {
+    GPU_Circle(this->target, x, y, radius, colour);
+  }
+
+  void SDLGPURenderBackend::drawTexturedTriangles(GPU_Image* image,
+                                                  float* vertexValues,
+                                                  int32_t numVertices,
+                                                  unsigned short* indexes,
+                                                  int32_t numIndexes)
+  {
+    if (image == nullptr) {
+      // Same as with blits, there's nothing to draw for frames read back from
+      // a file.
+      return;
+    }
+
+    GPU_TriangleBatch(image,
+                      this->target,
+                      static_cast<unsigned short>(numVertices),
+                      vertexValues,
+                      static_cast<unsigned int>(numIndexes),
+                      indexes,
+                      GPU_BATCH_XY_ST_RGBA);
+  }
+
+  void SDLGPURenderBackend::updateImage(GPU_Image* image,
+                                        const uint8_t* pixels,
+                                        int32_t numBytesPerRow)
+  {
+    if (image == nullptr) {
+      return;
+    }
+
+    GPU_UpdateImageBytes(image, nullptr, pixels, numBytesPerRow);
+  }
+}
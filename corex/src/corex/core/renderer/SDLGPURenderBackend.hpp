@@ -0,0 +1,55 @@
+#ifndef COREX_CORE_RENDERER_SDL_GPU_RENDER_BACKEND_HPP
+#define COREX_CORE_RENDERER_SDL_GPU_RENDER_BACKEND_HPP
+
+#include <cstdint>
+
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderBackend.hpp>
+
+namespace corex::core
+{
+  // Draws commands onto an SDL_gpu render target.
+  class SDLGPURenderBackend : public RenderBackend
+  {
+  public:
+    explicit SDLGPURenderBackend(GPU_Target* target);
+
+    void clear(SDL_Color colour) override;
+    void setCamera(const GPU_Camera& camera) override;
+    void blit(GPU_Image* image,
+              const GPU_Rect& srcRect,
+              const GPU_Rect& dstRect) override;
+    void drawPolygon(float* vertices,
+                     int32_t numVertices,
+                     SDL_Color colour) override;
+    void drawTriangles(float* vertexValues,
+                       int32_t numVertices,
+                       unsigned short* indexes,
+                       int32_t numIndexes) override;
+    void drawLines(float* vertexValues,
+                   int32_t numVertices,
+                   unsigned short* indexes,
+                   int32_t numIndexes) override;
+    void drawCircle(float x, float y, float radius, SDL_Color colour) override;
+    void drawTexturedTriangles(GPU_Image* image,
+                               float* vertexValues,
+                               int32_t numVertices,
+                               unsigned short* indexes,
+                               int32_t numIndexes) override;
+    void updateImage(GPU_Image* image,
+                     const uint8_t* pixels,
+                     int32_t numBytesPerRow) override;
+
+  private:
+    GPU_Target* target;
+  };
+}
+
+namespace cx
+{
+  using namespace corex::core;
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include <SDL_gpu.h>
 
 #include <corex/core/sdl_deleters.hpp>
+#include <corex/core/renderer/GPUContextLock.hpp>
 
 namespace corex::core
 {
@@ -22,11 +23,13 @@ namespace corex::core
 
   void SDLGPUTargetDeleter::operator()(GPU_Target* target)
   {
+    GPUContextLock contextLock;
     GPU_FreeTarget(target);
   }
 
   void SDLGPUImageDeleter::operator()(GPU_Image* image)
   {
+    GPUContextLock contextLock;
     GPU_FreeImage(image);
   }
 }
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/components/RenderGeometryCache.hpp>
+#include <corex/core/components/RenderPolygon.hpp>
+#include <corex/core/components/RenderRectangle.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Polygon.hpp>
+#include <corex/core/systems/BaseSystem.hpp>
+#include <corex/core/systems/RenderGeometryCacher.hpp>
+
+namespace corex::core
+{
+  // Functions and that should only be accessible here.
+  AABB _computeVerticesAABB(const eastl::vector<float>& vertices)
+  {
+    AABB bounds{
+      Point{ std::numeric_limits<float>::max(),
+             std::numeric_limits<float>::max() },
+      Point{ std::numeric_limits<float>::lowest(),
+             std::numeric_limits<float>::lowest() }
+    };
+    for (int32_t i = 0; i + 1 < vertices.size(); i += 2) {
+      bounds.minPt.x = std::min(bounds.minPt.x, vertices[i]);
+      bounds.minPt.y = std::min(bounds.minPt.y, vertices[i + 1]);
+      bounds.maxPt.x = std::max(bounds.maxPt.x, vertices[i]);
+      bounds.maxPt.y = std::max(bounds.maxPt.y, vertices[i + 1]);
+    }
+
+    return bounds;
+  }
+
+  bool _isCacheOutdated(const RenderGeometryCache& cache,
+                        const RenderRectangle& rect)
+  {
+    return cache.isDirty
+           || cache.x != rect.x
+           || cache.y != rect.y
+           || cache.width != rect.width
+           || cache.height != rect.height
+           || cache.angle != rect.angle;
+  }
+  /////////////////////////////////////////////////
+
+  RenderGeometryCacher::RenderGeometryCacher(entt::dispatcher& eventDispatcher,
+                                             entt::registry& registry)
+    : BaseSystem(eventDispatcher)
+    , registry(registry)
+  {
+    this->registry.on_construct<RenderRectangle>()
+                  .connect<&RenderGeometryCacher::handleGeometryChanges>(this);
+    this->registry.on_update<RenderRectangle>()
+                  .connect<&RenderGeometryCacher::handleGeometryChanges>(this);
+    this->registry.on_construct<RenderPolygon>()
+                  .connect<&RenderGeometryCacher::handleGeometryChanges>(this);
+    this->registry.on_update<RenderPolygon>()
+                  .connect<&RenderGeometryCacher::handleGeometryChanges>(this);
+  }
+
+  RenderGeometryCacher::~RenderGeometryCacher()
+  {
+    this->registry.on_construct<RenderRectangle>()
+                  .disconnect<&RenderGeometryCacher::handleGeometryChanges>(
+                    this);
+    this->registry.on_update<RenderRectangle>()
+                  .disconnect<&RenderGeometryCacher::handleGeometryChanges>(
+                    this);
+    this->registry.on_construct<RenderPolygon>()
+                  .disconnect<&RenderGeometryCacher::handleGeometryChanges>(
+                    this);
+    this->registry.on_update<RenderPolygon>()
+                  .disconnect<&RenderGeometryCacher::handleGeometryChanges>(
+                    this);
+  }
+
+  void RenderGeometryCacher::update()
+  {
+    this->updateRectangleCaches();
+    this->updatePolygonCaches();
+  }
+
+  void RenderGeometryCacher::handleGeometryChanges(entt::registry& registry,
+                                                   entt::entity entity)
+  {
+    auto* cache = registry.try_get<RenderGeometryCache>(entity);
+    if (cache == nullptr) {
+      registry.emplace<RenderGeometryCache>(entity,
+                                            eastl::vector<float>{},
+                                            AABB{},
+                                            0.f, 0.f, 0.f, 0.f, 0.f,
+                                            true);
+    } else {
+      cache->isDirty = true;
+    }
+  }
+
+  void RenderGeometryCacher::updateRectangleCaches()
+  {
+    auto view = this->registry.view<RenderRectangle, RenderGeometryCache>();
+    for (entt::entity e : view) {
+      const auto& rect = view.get<RenderRectangle>(e);
+      auto& cache = view.get<RenderGeometryCache>(e);
+      if (!_isCacheOutdated(cache, rect)) {
+        continue;
+      }
+
+      Polygon<4> rotatedRect = rotateRectangle(rect.x,
+                                               rect.y,
+                                               rect.width,
+                                               rect.height,
+                                               rect.angle);
+      cache.vertices.resize(8);
+      for (int32_t i = 0; i < 4; i++) {
+        cache.vertices[i * 2] = rotatedRect.vertices[i].x;
+        cache.vertices[(i * 2) + 1] = rotatedRect.vertices[i].y;
+      }
+
+      cache.bounds = _computeVerticesAABB(cache.vertices);
+      cache.x = rect.x;
+      cache.y = rect.y;
+      cache.width = rect.width;
+      cache.height = rect.height;
+      cache.angle = rect.angle;
+      cache.isDirty = false;
+    }
+  }
+
+  void RenderGeometryCacher::updatePolygonCaches()
+  {
+    auto view = this->registry.view<RenderPolygon, RenderGeometryCache>();
+    for (entt::entity e : view) {
+      auto& cache = view.get<RenderGeometryCache>(e);
+      if (!cache.isDirty) {
+        continue;
+      }
+
+      const auto& poly = view.get<RenderPolygon>(e);
+      const int32_t numVertices = poly.vertices.size();
+      cache.vertices.resize(numVertices * 2);
+      for (int32_t i = 0; i < numVertices; i++) {
+        cache.vertices[i * 2] = poly.vertices[i].x;
+        cache.vertices[(i * 2) + 1] = poly.vertices[i].y;
+      }
+
+      cache.bounds = _computeVerticesAABB(cache.vertices);
+      cache.isDirty = false;
+    }
+  }
+}
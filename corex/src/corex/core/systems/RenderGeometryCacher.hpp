@@ -0,0 +1,36 @@
+#ifndef COREX_SYSTEMS_CORE_RENDER_GEOMETRY_CACHER_HPP
+#define COREX_SYSTEMS_CORE_RENDER_GEOMETRY_CACHER_HPP
+
+#include <entt/entt.hpp>
+
+#include <corex/core/systems/BaseSystem.hpp>
+
+namespace corex::core
+{
+  // Keeps the RenderGeometryCache of every RenderRectangle and RenderPolygon
+  // up to date. A rectangle's vertices are only rebuilt when its center, size,
+  // or angle changes. A polygon's vertices are only rebuilt when its
+  // RenderPolygon gets added, replaced, or patched, so modify the vertices of
+  // a RenderPolygon through registry.patch() or registry.replace().
+  class RenderGeometryCacher : public BaseSystem
+  {
+  public:
+    RenderGeometryCacher(entt::dispatcher& eventDispatcher,
+                         entt::registry& registry);
+    ~RenderGeometryCacher();
+
+    RenderGeometryCacher(const RenderGeometryCacher&) = delete;
+    RenderGeometryCacher& operator=(const RenderGeometryCacher&) = delete;
+
+    void update();
+
+  private:
+    entt::registry& registry;
+
+    void handleGeometryChanges(entt::registry& registry, entt::entity entity);
+    void updateRectangleCaches();
+    void updatePolygonCaches();
+  };
+}
+
+#endif
@@ -5,9 +5,12 @@
 #error "No support available for non-Linux systems."
 #endif
 #include <filesystem>
+#include <random>
 #include <string>
 
 #include <EASTL/string.h>
+#include <pcg_random.hpp>
+#include <SDL2/SDL.h>
 
 #include <corex/core/Camera.hpp>
 #include <corex/core/utils.hpp>
@@ -45,6 +48,15 @@ namespace corex::core
     return eastl::string(str.c_str());
   }
 
+  pcg32& getRandomNumberGenerator()
+  {
+    thread_local pcg32 rng{
+      pcg_extras::seed_seq_from<std::random_device>{}
+    };
+
+    return rng;
+  }
+
   float getRandomRealUniformly(float a, float b)
   {
     return generateRandomReal(std::uniform_real_distribution<float>{ a, b });
@@ -77,4 +89,9 @@ namespace corex::core
       point.y + camera.getY()
     };
   }
+
+  bool areColoursEqual(SDL_Color a, SDL_Color b)
+  {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+  }
 }
@@ -10,6 +10,7 @@
 #include <EASTL/string.h>
 #include <nlohmann/json.hpp>
 #include <pcg_random.hpp>
+#include <SDL2/SDL.h>
 
 #include <corex/core/Camera.hpp>
 #include <corex/core/ds/Point.hpp>
@@ -46,22 +47,21 @@ namespace corex::core
     return search != s.end();
   }
 
+  // Returns a random number generator local to the calling thread. It is
+  // seeded only once, so use this instead of creating and seeding a new
+  // generator every time a random number is needed.
+  pcg32& getRandomNumberGenerator();
+
   template <class T>
   T generateRandomInt(std::uniform_int_distribution<T> distribution)
   {
-    pcg_extras::seed_seq_from<std::random_device> seedSource;
-    pcg32 rng(seedSource);
-
-    return distribution(rng);
+    return distribution(getRandomNumberGenerator());
   }
 
   template <class T>
   T generateRandomReal(std::uniform_real_distribution<T> distribution)
   {
-    pcg_extras::seed_seq_from<std::random_device> seedSource;
-    pcg32 rng(seedSource);
-
-    return distribution(rng);
+    return distribution(getRandomNumberGenerator());
   }
 
   float getRandomRealUniformly(float a, float b);
@@ -71,6 +71,8 @@ namespace corex::core
   float metersToPixels(float meters, float ppmRatio);
   float pixelsToMeters(float pixels, float ppmRatio);
   Point screenToWorldCoordinates(const Point&& point, Camera& camera);
+
+  bool areColoursEqual(SDL_Color a, SDL_Color b);
 }
 
 namespace cx
@@ -0,0 +1,168 @@
+#include <cstdint>
+#include <limits>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
+
+namespace
+{
+  // Gives every point of every frame a value that can't be mistaken for
+  // another, so that a misplaced point always gets caught.
+  cx::PointHistory createHistory(int32_t numFrames, int32_t numPoints)
+  {
+    cx::PointHistory history{ numPoints, numFrames };
+    eastl::vector<cx::Point> frame(numPoints);
+    for (int32_t f = 0; f < numFrames; f++) {
+      for (int32_t p = 0; p < numPoints; p++) {
+        frame[p] = cx::Point{ static_cast<float>(f),
+                              static_cast<float>(p) };
+      }
+
+      history.addFrame(frame.data());
+    }
+
+    return history;
+  }
+
+  // Every point moves differently between frames, so that interpolating
+  // between the wrong pair of frames or points gets caught.
+  cx::PointHistory createMovingHistory(int32_t numFrames, int32_t numPoints)
+  {
+    cx::PointHistory history{ numPoints, numFrames };
+    eastl::vector<cx::Point> frame(numPoints);
+    for (int32_t f = 0; f < numFrames; f++) {
+      for (int32_t p = 0; p < numPoints; p++) {
+        frame[p] = cx::Point{ static_cast<float>((f * f) + p),
+                              static_cast<float>((p * p) - (3 * f)) };
+      }
+
+      history.addFrame(frame.data());
+    }
+
+    return history;
+  }
+
+  void requireSameFrame(const cx::PointHistory& history,
+                        int32_t frameIndex,
+                        const eastl::vector<cx::Point>& points)
+  {
+    const cx::Point* frame = history.getFrame(frameIndex);
+    for (int32_t p = 0; p < history.getNumPoints(); p++) {
+      CAPTURE(p);
+      REQUIRE(points[p].x == frame[p].x);
+      REQUIRE(points[p].y == frame[p].y);
+    }
+  }
+
+  void requireTransposed(const cx::PointHistory& history,
+                         const cx::PointHistory& transposedHistory)
+  {
+    REQUIRE(transposedHistory.getNumFrames() == history.getNumPoints());
+    REQUIRE(transposedHistory.getNumPoints() == history.getNumFrames());
+
+    int32_t numMismatches = 0;
+    for (int32_t f = 0; f < history.getNumFrames(); f++) {
+      for (int32_t p = 0; p < history.getNumPoints(); p++) {
+        const cx::Point& point = history.getPoint(f, p);
+        const cx::Point& transposedPoint = transposedHistory.getPoint(p, f);
+        if (point.x != transposedPoint.x || point.y != transposedPoint.y) {
+          numMismatches++;
+        }
+      }
+    }
+
+    REQUIRE(numMismatches == 0);
+  }
+}
+
+TEST_CASE("PointHistory::transpose() around the tile edges", "[PointHistory]")
+{
+  // Tiles are 64 by 64 points, so these cover histories smaller than a tile,
+  // exactly a tile, and a tile plus a partial one, in both directions.
+  const int32_t numFrames = GENERATE(1, 2, 63, 64, 65, 130);
+  const int32_t numPoints = GENERATE(1, 3, 63, 64, 65, 129);
+  CAPTURE(numFrames, numPoints);
+
+  const cx::PointHistory history = createHistory(numFrames, numPoints);
+  const cx::PointHistory transposedHistory = history.transpose();
+  requireTransposed(history, transposedHistory);
+
+  // Transposing twice must give back the original history.
+  requireTransposed(transposedHistory, transposedHistory.transpose());
+}
+
+TEST_CASE("PointHistory::transpose() with an empty history", "[PointHistory]")
+{
+  const cx::PointHistory history{ 10 };
+  const cx::PointHistory transposedHistory = history.transpose();
+  REQUIRE(transposedHistory.empty());
+  REQUIRE(transposedHistory.getNumFrames() == 0);
+
+  REQUIRE(cx::PointHistory{}.transpose().empty());
+}
+
+TEST_CASE("PointHistory::transpose() with a history big enough for threads",
+          "[PointHistory]")
+{
+  // Large histories get split into blocks of points that are transposed on
+  // separate threads. The number of points is not a multiple of the tile
+  // size, so the last block ends in a partial tile.
+  const cx::PointHistory history = createHistory(800, 1000);
+  requireTransposed(history, history.transpose());
+}
+
+TEST_CASE("PointHistory::interpolate() matches a scalar lerp",
+          "[PointHistory]")
+{
+  // Four points are interpolated at a time, so these cover histories that
+  // only take the scalar tail, only the SIMD path, and both.
+  const int32_t numPoints = GENERATE(1, 3, 4, 5, 9);
+  CAPTURE(numPoints);
+
+  const int32_t numFrames = 4;
+  const cx::PointHistory history = createMovingHistory(numFrames, numPoints);
+  eastl::vector<cx::Point> points(numPoints);
+
+  SECTION("Frame positions give the frames as is")
+  {
+    for (int32_t f = 0; f < numFrames; f++) {
+      CAPTURE(f);
+      history.interpolate(static_cast<float>(f), points.data());
+      requireSameFrame(history, f, points);
+    }
+  }
+
+  SECTION("Positions between frames")
+  {
+    for (float framePosition : { 0.25f, 1.5f, 2.875f }) {
+      CAPTURE(framePosition);
+      history.interpolate(framePosition, points.data());
+
+      const int32_t fromFrame = static_cast<int32_t>(framePosition);
+      const float t = framePosition - fromFrame;
+      for (int32_t p = 0; p < numPoints; p++) {
+        CAPTURE(p);
+        const cx::Point& from = history.getPoint(fromFrame, p);
+        const cx::Point& to = history.getPoint(fromFrame + 1, p);
+        REQUIRE(points[p].x == Approx(from.x + ((to.x - from.x) * t)));
+        REQUIRE(points[p].y == Approx(from.y + ((to.y - from.y) * t)));
+      }
+    }
+  }
+
+  SECTION("Positions outside the history get clamped")
+  {
+    history.interpolate(-2.5f, points.data());
+    requireSameFrame(history, 0, points);
+
+    history.interpolate(numFrames + 3.5f, points.data());
+    requireSameFrame(history, numFrames - 1, points);
+
+    history.interpolate(std::numeric_limits<float>::quiet_NaN(),
+                        points.data());
+    requireSameFrame(history, 0, points);
+  }
+}
@@ -0,0 +1,214 @@
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <catch2/catch.hpp>
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+#include <pcg_random.hpp>
+
+#include <corex/core/ReturnState.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/QuadTree.hpp>
+
+namespace
+{
+  const cx::AABB treeBounds{ cx::Point{ 0.f, 0.f }, cx::Point{ 100.f, 100.f } };
+
+  eastl::vector<cx::Point> createRandomPoints(int32_t numPoints,
+                                              float minValue,
+                                              float maxValue)
+  {
+    pcg32 rng{ 42u };
+    std::uniform_real_distribution<float> distribution{ minValue, maxValue };
+    eastl::vector<cx::Point> points;
+    for (int32_t i = 0; i < numPoints; i++) {
+      const float x = distribution(rng);
+      const float y = distribution(rng);
+      points.push_back(cx::Point{ x, y });
+    }
+
+    return points;
+  }
+
+  float getSqrdDistance(const cx::Point& pt0, const cx::Point& pt1)
+  {
+    const float dx = pt1.x - pt0.x;
+    const float dy = pt1.y - pt0.y;
+    return (dx * dx) + (dy * dy);
+  }
+
+  // Returns the smallest distance from the point to any of the points, or
+  // the maximum float if there are none.
+  float findNearestSqrdDistance(const cx::Point& point,
+                                const eastl::vector<cx::Point>& points)
+  {
+    float nearestSqrdDist = std::numeric_limits<float>::max();
+    for (const cx::Point& pt : points) {
+      nearestSqrdDist = eastl::min(nearestSqrdDist,
+                                   getSqrdDistance(point, pt));
+    }
+
+    return nearestSqrdDist;
+  }
+}
+
+TEST_CASE("QuadTree starts out empty", "[QuadTree]")
+{
+  const cx::QuadTree<int32_t> tree{ treeBounds };
+  REQUIRE(tree.isEmpty());
+  REQUIRE(tree.size() == 0);
+
+  eastl::vector<int32_t> results{ 1, 2, 3 };
+  tree.queryRange(treeBounds, results);
+  REQUIRE(results.empty());
+  REQUIRE(tree.queryNearest(cx::Point{ 50.f, 50.f }).status
+          == cx::ReturnState::RETURN_FAIL);
+}
+
+TEST_CASE("QuadTree::queryRange() finds the points in the range",
+          "[QuadTree]")
+{
+  // Enough points to split the tree a few times.
+  const eastl::vector<cx::Point> points = createRandomPoints(500, 0.f, 100.f);
+  eastl::vector<int32_t> items;
+  for (int32_t i = 0; i < points.size(); i++) {
+    items.push_back(i);
+  }
+
+  cx::QuadTree<int32_t> tree{ treeBounds };
+  tree.build(items, points);
+  REQUIRE(tree.size() == points.size());
+
+  const cx::AABB range{ cx::Point{ 20.f, 35.f }, cx::Point{ 60.f, 45.f } };
+  eastl::vector<int32_t> results;
+  tree.queryRange(range, results);
+
+  eastl::vector<int32_t> expectedResults;
+  for (int32_t i = 0; i < points.size(); i++) {
+    if (points[i].x >= range.minPt.x && points[i].x <= range.maxPt.x
+        && points[i].y >= range.minPt.y && points[i].y <= range.maxPt.y) {
+      expectedResults.push_back(i);
+    }
+  }
+
+  eastl::sort(results.begin(), results.end());
+  REQUIRE(!expectedResults.empty());
+  REQUIRE(results == expectedResults);
+}
+
+TEST_CASE("QuadTree::queryRange() reports straddling rectangles once",
+          "[QuadTree]")
+{
+  cx::QuadTree<int32_t> tree{ treeBounds, 1 };
+
+  // The rectangle in the middle straddles all four quadrants once the tree
+  // splits.
+  tree.insert(0, cx::AABB{ cx::Point{ 40.f, 40.f }, cx::Point{ 60.f, 60.f } });
+  tree.insert(1, cx::Point{ 10.f, 10.f });
+  tree.insert(2, cx::Point{ 90.f, 90.f });
+
+  eastl::vector<int32_t> results;
+  tree.queryRange(treeBounds, results);
+  eastl::sort(results.begin(), results.end());
+  REQUIRE(results == eastl::vector<int32_t>{ 0, 1, 2 });
+
+  tree.queryRange(cx::AABB{ cx::Point{ 45.f, 45.f }, cx::Point{ 55.f, 55.f } },
+                  results);
+  REQUIRE(results == eastl::vector<int32_t>{ 0 });
+}
+
+TEST_CASE("QuadTree::remove() takes out only the given element", "[QuadTree]")
+{
+  cx::QuadTree<int32_t> tree{ treeBounds, 1 };
+  const int32_t id0 = tree.insert(0, cx::Point{ 10.f, 10.f });
+  const int32_t id1 = tree.insert(1, cx::Point{ 12.f, 12.f });
+  const int32_t id2 = tree.insert(2, cx::Point{ 80.f, 80.f });
+
+  REQUIRE(tree.remove(id1));
+  REQUIRE(!tree.remove(id1));
+  REQUIRE(!tree.remove(-1));
+  REQUIRE(!tree.remove(100));
+  REQUIRE(tree.size() == 2);
+
+  eastl::vector<int32_t> results;
+  tree.queryRange(treeBounds, results);
+  eastl::sort(results.begin(), results.end());
+  REQUIRE(results == eastl::vector<int32_t>{ 0, 2 });
+
+  auto nearest = tree.queryNearest(cx::Point{ 12.f, 12.f });
+  REQUIRE(nearest.status == cx::ReturnState::RETURN_OK);
+  REQUIRE(nearest.value == 0);
+
+  // Removed slots get reused.
+  const int32_t id3 = tree.insert(3, cx::Point{ 50.f, 50.f });
+  REQUIRE(id3 == id1);
+  REQUIRE(tree.size() == 3);
+
+  REQUIRE(tree.remove(id0));
+  REQUIRE(tree.remove(id2));
+  REQUIRE(tree.remove(id3));
+  REQUIRE(tree.isEmpty());
+}
+
+TEST_CASE("QuadTree::queryNearest() matches a brute force search",
+          "[QuadTree]")
+{
+  // Some of the points are outside the bounds of the tree, which still have
+  // to be found.
+  const eastl::vector<cx::Point> points = createRandomPoints(300, -20.f, 120.f);
+  cx::QuadTree<int32_t> tree{ treeBounds, 4 };
+  for (int32_t i = 0; i < points.size(); i++) {
+    tree.insert(i, points[i]);
+  }
+
+  const eastl::vector<cx::Point> queryPoints = createRandomPoints(200,
+                                                                  -50.f,
+                                                                  150.f);
+  int32_t numMismatches = 0;
+  for (const cx::Point& queryPoint : queryPoints) {
+    auto nearest = tree.queryNearest(queryPoint);
+    if (nearest.status != cx::ReturnState::RETURN_OK
+        || getSqrdDistance(queryPoint, points[nearest.value])
+           != findNearestSqrdDistance(queryPoint, points)) {
+      numMismatches++;
+    }
+  }
+
+  REQUIRE(numMismatches == 0);
+}
+
+TEST_CASE("QuadTree::queryNearest() respects the maximum distance",
+          "[QuadTree]")
+{
+  cx::QuadTree<int32_t> tree{ treeBounds };
+  tree.insert(7, cx::Point{ 50.f, 50.f });
+
+  auto nearest = tree.queryNearest(cx::Point{ 53.f, 54.f }, 5.f);
+  REQUIRE(nearest.status == cx::ReturnState::RETURN_OK);
+  REQUIRE(nearest.value == 7);
+
+  nearest = tree.queryNearest(cx::Point{ 54.f, 54.f }, 5.f);
+  REQUIRE(nearest.status == cx::ReturnState::RETURN_FAIL);
+}
+
+TEST_CASE("QuadTree::clear() removes everything", "[QuadTree]")
+{
+  cx::QuadTree<int32_t> tree{ treeBounds, 1 };
+  for (int32_t i = 0; i < 50; i++) {
+    tree.insert(i, cx::Point{ static_cast<float>(i * 2), 50.f });
+  }
+
+  tree.clear();
+  REQUIRE(tree.isEmpty());
+
+  eastl::vector<int32_t> results;
+  tree.queryRange(treeBounds, results);
+  REQUIRE(results.empty());
+
+  tree.insert(1, cx::Point{ 25.f, 25.f });
+  auto nearest = tree.queryNearest(cx::Point{ 0.f, 0.f });
+  REQUIRE(nearest.status == cx::ReturnState::RETURN_OK);
+  REQUIRE(nearest.value == 1);
+}
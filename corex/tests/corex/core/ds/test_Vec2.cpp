@@ -0,0 +1,70 @@
+#include <cstdint>
+#include <type_traits>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/ds/Vec2.hpp>
+
+TEST_CASE("Vec2 operators can be evaluated at compile time", "[Vec2]")
+{
+  constexpr cx::Vec2 p{ 1.f, 2.f };
+  constexpr cx::Vec2 q{ 3.f, -4.f };
+
+  static_assert((p + q) == cx::Vec2{ 4.f, -2.f });
+  static_assert((p - q) == cx::Vec2{ -2.f, 6.f });
+  static_assert((p * 2) == cx::Vec2{ 2.f, 4.f });
+  static_assert((0.5f * q) == cx::Vec2{ 1.5f, -2.f });
+  static_assert((q / 2.f) == cx::Vec2{ 1.5f, -2.f });
+  static_assert(p != q);
+  static_assert(std::is_trivially_copyable_v<cx::Vec2>);
+
+  SUCCEED();
+}
+
+TEST_CASE("Vec2 operators do not round their results", "[Vec2]")
+{
+  // The operators used to round to six decimal places. Callers that need
+  // rounding now have to call setDecPlaces() themselves.
+  const cx::Vec2 p = cx::Vec2{ 0.1234567f, 0.f } + cx::Vec2{ 0.f, 0.f };
+  REQUIRE(p.x == 0.1234567f);
+  REQUIRE(cx::setDecPlaces(p.x, 6) == 0.123457f);
+
+  // Equality is still tolerance-based.
+  REQUIRE(cx::Vec2{ 0.1f + 0.2f, 0.f } == cx::Vec2{ 0.3f, 0.f });
+}
+
+TEST_CASE("Vec2 arithmetic benchmark", "[!benchmark][Vec2]")
+{
+  constexpr int32_t numPoints = 4096;
+  eastl::vector<cx::Vec2> points;
+  for (int32_t i = 0; i < numPoints; i++) {
+    points.push_back(cx::Vec2{ i * 0.25f, i * -0.5f });
+  }
+
+  // Same work as the loops below, but rounding after every operation, like
+  // the operators did when they were still defined in Vec2.cpp.
+  BENCHMARK("Sum of scaled points, rounded per operation")
+  {
+    cx::Vec2 sum;
+    for (const cx::Vec2& p : points) {
+      const cx::Vec2 scaled{ cx::setDecPlaces(p.x * 0.5f, 6),
+                             cx::setDecPlaces(p.y * 0.5f, 6) };
+      sum = cx::Vec2{ cx::setDecPlaces(sum.x + scaled.x, 6),
+                      cx::setDecPlaces(sum.y + scaled.y, 6) };
+    }
+
+    return sum;
+  };
+
+  BENCHMARK("Sum of scaled points")
+  {
+    cx::Vec2 sum;
+    for (const cx::Vec2& p : points) {
+      sum = sum + (p * 0.5f);
+    }
+
+    return sum;
+  };
+}
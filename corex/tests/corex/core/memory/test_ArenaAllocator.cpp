@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <string>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+
+#include <corex/core/memory/ArenaAllocator.hpp>
+#include <corex/core/memory/LinearArena.hpp>
+
+TEST_CASE("ArenaAllocator allocates from its arena", "[ArenaAllocator]")
+{
+  cx::LinearArena arena{ 1024 };
+  cx::ArenaAllocator allocator{ &arena, "Test Allocator" };
+  REQUIRE(allocator.getArena() == &arena);
+
+  void* ptr = allocator.allocate(100);
+  REQUIRE(ptr != nullptr);
+  REQUIRE(arena.getNumBytesUsed() >= 100);
+
+  void* alignedPtr = allocator.allocate(64, 32, 0);
+  REQUIRE((reinterpret_cast<uintptr_t>(alignedPtr) % 32) == 0);
+
+  // Deallocating leaves the memory to the arena.
+  const size_t numBytesUsed = arena.getNumBytesUsed();
+  allocator.deallocate(ptr, 100);
+  REQUIRE(arena.getNumBytesUsed() == numBytesUsed);
+
+  REQUIRE(std::string{ allocator.get_name() } == "Test Allocator");
+  allocator.set_name("Renamed Allocator");
+  REQUIRE(std::string{ allocator.get_name() } == "Renamed Allocator");
+}
+
+TEST_CASE("ArenaAllocator compares by arena", "[ArenaAllocator]")
+{
+  cx::LinearArena arena{ 1024 };
+  cx::LinearArena otherArena{ 1024 };
+  const cx::ArenaAllocator allocator{ &arena };
+
+  REQUIRE(allocator == cx::ArenaAllocator{ &arena, "Other Name" });
+  REQUIRE(allocator != cx::ArenaAllocator{ &otherArena });
+  REQUIRE(cx::ArenaAllocator{ allocator, "Copy" }.getArena() == &arena);
+}
+
+TEST_CASE("EASTL containers can use an arena", "[ArenaAllocator]")
+{
+  cx::LinearArena arena{ 1024 };
+  eastl::vector<int32_t, cx::ArenaAllocator> values{
+    cx::ArenaAllocator{ &arena }
+  };
+  for (int32_t i = 0; i < 100; i++) {
+    values.push_back(i);
+  }
+
+  REQUIRE(values.size() == 100);
+  REQUIRE(values.front() == 0);
+  REQUIRE(values.back() == 99);
+  REQUIRE(arena.getNumBytesUsed() >= 100 * sizeof(int32_t));
+}
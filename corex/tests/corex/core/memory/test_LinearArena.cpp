@@ -0,0 +1,89 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <corex/core/memory/LinearArena.hpp>
+
+namespace
+{
+  struct alignas(16) Vec4
+  {
+    float values[4];
+  };
+
+  struct alignas(32) Vec8
+  {
+    float values[8];
+  };
+
+  bool isAligned(const void* ptr, size_t alignment)
+  {
+    return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+  }
+}
+
+TEST_CASE("LinearArena::allocateArray() aligns to the type", "[LinearArena]")
+{
+  cx::LinearArena arena{ 4096 };
+
+  // Throw the next allocation off by a byte each time.
+  for (int32_t i = 0; i < 8; i++) {
+    arena.allocate(1, 1);
+
+    Vec4* vec4s = arena.allocateArray<Vec4>(3);
+    REQUIRE(isAligned(vec4s, alignof(Vec4)));
+
+    arena.allocate(1, 1);
+
+    Vec8* vec8s = arena.allocateArray<Vec8>(3);
+    REQUIRE(isAligned(vec8s, alignof(Vec8)));
+  }
+
+  REQUIRE(arena.getNumBlocks() == 1);
+}
+
+TEST_CASE("LinearArena spills into new blocks", "[LinearArena]")
+{
+  cx::LinearArena arena{ 256 };
+  REQUIRE(arena.getNumBlocks() == 1);
+  REQUIRE(arena.getCapacity() == 256);
+
+  char* first = static_cast<char*>(arena.allocate(200));
+  char* second = static_cast<char*>(arena.allocate(200));
+  REQUIRE(arena.getNumBlocks() == 2);
+  REQUIRE(arena.getNumBytesUsed() >= 400);
+
+  // The allocations must not overlap.
+  REQUIRE((second >= first + 200 || second + 200 <= first));
+
+  // Allocations bigger than the block size get a block of their own.
+  Vec8* vec8s = arena.allocateArray<Vec8>(64);
+  REQUIRE(isAligned(vec8s, alignof(Vec8)));
+  REQUIRE(arena.getNumBlocks() == 3);
+  REQUIRE(arena.getCapacity() >= 256 + 256 + (64 * sizeof(Vec8)));
+}
+
+TEST_CASE("LinearArena::reset() merges the blocks into one", "[LinearArena]")
+{
+  cx::LinearArena arena{ 256 };
+  for (int32_t i = 0; i < 10; i++) {
+    arena.allocate(200);
+  }
+
+  REQUIRE(arena.getNumBlocks() > 1);
+  const size_t capacity = arena.getCapacity();
+
+  arena.reset();
+  REQUIRE(arena.getNumBlocks() == 1);
+  REQUIRE(arena.getCapacity() == capacity);
+  REQUIRE(arena.getNumBytesUsed() == 0);
+
+  // Everything from before fits without a new block now.
+  for (int32_t i = 0; i < 10; i++) {
+    arena.allocate(200);
+  }
+
+  REQUIRE(arena.getNumBlocks() == 1);
+  REQUIRE(arena.getCapacity() == capacity);
+}
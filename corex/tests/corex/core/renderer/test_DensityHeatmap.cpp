@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+#include <pcg_random.hpp>
+
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/DensityHeatmap.hpp>
+
+namespace
+{
+  const cx::AABB heatmapBounds{ cx::Point{ 0.f, 0.f },
+                                cx::Point{ 100.f, 50.f } };
+  constexpr int32_t numColumns = 16;
+  constexpr int32_t numRows = 8;
+
+  // Points from both inside and outside of the bounds, with the points that
+  // are easy to get wrong first, so that they go through the SIMD path, and
+  // last, so that they go through the scalar tail.
+  eastl::vector<cx::Point> createPoints(int32_t numRandomPoints)
+  {
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    const eastl::vector<cx::Point> edgePoints{
+      heatmapBounds.maxPt,
+      heatmapBounds.minPt,
+      cx::Point{ heatmapBounds.maxPt.x, heatmapBounds.minPt.y },
+      cx::Point{ nan, 10.f },
+      cx::Point{ 10.f, nan },
+      cx::Point{ -0.001f, 10.f },
+      cx::Point{ 10.f, 50.001f }
+    };
+
+    eastl::vector<cx::Point> points = edgePoints;
+    pcg32 rng{ 42u };
+    std::uniform_real_distribution<float> distribution{ -20.f, 120.f };
+    for (int32_t i = 0; i < numRandomPoints; i++) {
+      const float x = distribution(rng);
+      const float y = distribution(rng);
+      points.push_back(cx::Point{ x, y });
+    }
+
+    points.insert(points.end(), edgePoints.begin(), edgePoints.end());
+    return points;
+  }
+
+  eastl::vector<uint32_t> countPoints(const eastl::vector<cx::Point>& points)
+  {
+    const float columnsPerUnit = numColumns
+                                 / (heatmapBounds.maxPt.x
+                                    - heatmapBounds.minPt.x);
+    const float rowsPerUnit = numRows
+                              / (heatmapBounds.maxPt.y
+                                 - heatmapBounds.minPt.y);
+
+    eastl::vector<uint32_t> counts(numColumns * numRows, 0);
+    for (const cx::Point& point : points) {
+      if (!(point.x >= heatmapBounds.minPt.x
+            && point.x <= heatmapBounds.maxPt.x
+            && point.y >= heatmapBounds.minPt.y
+            && point.y <= heatmapBounds.maxPt.y)) {
+        continue;
+      }
+
+      const int32_t column = std::min(
+        static_cast<int32_t>((point.x - heatmapBounds.minPt.x)
+                             * columnsPerUnit),
+        numColumns - 1);
+      const int32_t row = std::min(
+        static_cast<int32_t>((point.y - heatmapBounds.minPt.y)
+                             * rowsPerUnit),
+        numRows - 1);
+      counts[(row * numColumns) + column]++;
+    }
+
+    return counts;
+  }
+}
+
+TEST_CASE("DensityHeatmap::bin() matches a brute force count",
+          "[DensityHeatmap]")
+{
+  // Four points are binned at a time, so most of these leave a tail.
+  const int32_t numRandomPoints = GENERATE(0, 1, 2, 3, 4, 5, 101, 1003);
+  CAPTURE(numRandomPoints);
+
+  const eastl::vector<cx::Point> points = createPoints(numRandomPoints);
+  cx::DensityHeatmap heatmap{ numColumns, numRows };
+  heatmap.bin(points.data(), points.size(), heatmapBounds);
+
+  const eastl::vector<uint32_t> expectedCounts = countPoints(points);
+  REQUIRE(heatmap.getCounts() == expectedCounts);
+  REQUIRE(heatmap.getMaxCount()
+          == *std::max_element(expectedCounts.begin(), expectedCounts.end()));
+
+  // The corners on the maximum edges land in the last column.
+  REQUIRE(heatmap.getCounts()[(numRows * numColumns) - 1] >= 2);
+  REQUIRE(heatmap.getCounts()[numColumns - 1] >= 2);
+}
+
+TEST_CASE("DensityHeatmap::bin() replaces the previous counts",
+          "[DensityHeatmap]")
+{
+  const eastl::vector<cx::Point> points = createPoints(100);
+  cx::DensityHeatmap heatmap{ numColumns, numRows };
+  heatmap.bin(points.data(), points.size(), heatmapBounds);
+  REQUIRE(heatmap.getMaxCount() > 0);
+
+  const cx::Point point{ 1.f, 1.f };
+  heatmap.bin(&point, 1, heatmapBounds);
+  REQUIRE(heatmap.getMaxCount() == 1);
+  REQUIRE(heatmap.getCounts()[0] == 1);
+  REQUIRE(std::count(heatmap.getCounts().begin(),
+                     heatmap.getCounts().end(),
+                     0u) == (numColumns * numRows) - 1);
+
+  // Bounds with no area have no cells to count points in.
+  const cx::AABB flatBounds{ cx::Point{ 0.f, 0.f }, cx::Point{ 100.f, 0.f } };
+  heatmap.bin(points.data(), points.size(), flatBounds);
+  REQUIRE(heatmap.getMaxCount() == 0);
+  REQUIRE(std::count(heatmap.getCounts().begin(),
+                     heatmap.getCounts().end(),
+                     0u) == numColumns * numRows);
+}
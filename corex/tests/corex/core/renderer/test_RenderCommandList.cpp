@@ -0,0 +1,292 @@
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+#include <SDL2/SDL.h>
+#include <SDL_gpu.h>
+
+#include <corex/core/renderer/RenderBackend.hpp>
+#include <corex/core/renderer/RenderCommand.hpp>
+#include <corex/core/renderer/RenderCommandList.hpp>
+
+namespace
+{
+  // Keeps track of the images the commands were drawn with, instead of
+  // drawing anything.
+  class RecordingBackend : public cx::RenderBackend
+  {
+  public:
+    eastl::vector<GPU_Image*> images;
+    int32_t numCommands = 0;
+
+    void clear(SDL_Color colour) override { this->numCommands++; }
+    void setCamera(const GPU_Camera& camera) override { this->numCommands++; }
+
+    void blit(GPU_Image* image,
+              const GPU_Rect& srcRect,
+              const GPU_Rect& dstRect) override
+    {
+      this->images.push_back(image);
+      this->numCommands++;
+    }
+
+    void drawPolygon(float* vertices,
+                     int32_t numVertices,
+                     SDL_Color colour) override
+    {
+      this->numCommands++;
+    }
+
+    void drawTriangles(float* vertexValues,
+                       int32_t numVertices,
+                       unsigned short* indexes,
+                       int32_t numIndexes) override
+    {
+      this->numCommands++;
+    }
+
+    void drawLines(float* vertexValues,
+                   int32_t numVertices,
+                   unsigned short* indexes,
+                   int32_t numIndexes) override
+    {
+      this->numCommands++;
+    }
+
+    void drawCircle(float x, float y, float radius, SDL_Color colour) override
+    {
+      this->numCommands++;
+    }
+
+    void drawTexturedTriangles(GPU_Image* image,
+                               float* vertexValues,
+                               int32_t numVertices,
+                               unsigned short* indexes,
+                               int32_t numIndexes) override
+    {
+      this->images.push_back(image);
+      this->numCommands++;
+    }
+
+    void updateImage(GPU_Image* image,
+                     const uint8_t* pixels,
+                     int32_t numBytesPerRow) override
+    {
+      this->images.push_back(image);
+      this->numCommands++;
+    }
+  };
+
+  GPU_Image createImage()
+  {
+    GPU_Image image{};
+    image.w = 2;
+    image.h = 2;
+    return image;
+  }
+
+  // Records a frame with every type of command in it.
+  void recordFrame(cx::RenderCommandList& commandList,
+                   GPU_Image* image,
+                   float circleX)
+  {
+    // The image is 2 by 2 pixels.
+    const uint8_t pixels[] = {
+      255, 0, 0, 255, 0, 255, 0, 255,
+      0, 0, 255, 255, 255, 255, 255, 255
+    };
+    commandList.addImageUpdate(image, pixels, 8);
+
+    commandList.addClear(SDL_Color{ 115, 140, 153, 255 });
+
+    GPU_Camera camera{};
+    camera.x = 12.f;
+    camera.zoom_x = 2.f;
+    camera.zoom_y = 2.f;
+    commandList.addSetCamera(camera);
+
+    const float polygonVertices[] = { 0.f, 0.f, 10.f, 0.f, 10.f, 10.f };
+    commandList.addPolygon(polygonVertices, 3, SDL_Color{ 255, 0, 0, 255 },
+                           false);
+    commandList.addPolygon(polygonVertices, 3, SDL_Color{ 0, 255, 0, 255 },
+                           true);
+
+    // Gets merged into the filled polygon before it.
+    const float triangleValues[] = {
+      20.f, 20.f, 1.f, 0.f, 0.f, 1.f,
+      30.f, 20.f, 0.f, 1.f, 0.f, 1.f,
+      30.f, 30.f, 0.f, 0.f, 1.f, 1.f
+    };
+    const unsigned short triangleIndexes[] = { 0, 1, 2 };
+    commandList.addTriangles(triangleValues, 3, triangleIndexes, 3);
+
+    const unsigned short lineIndexes[] = { 0, 1, 1, 2 };
+    commandList.addLines(triangleValues, 3, lineIndexes, 4);
+    commandList.addCircle(circleX, 40.f, 5.f, SDL_Color{ 10, 41, 79, 255 });
+
+    commandList.addBlit(image,
+                        GPU_Rect{ 0.f, 0.f, 16.f, 16.f },
+                        GPU_Rect{ 50.f, 50.f, 16.f, 16.f });
+
+    const float texturedValues[] = {
+      0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f,
+      8.f, 0.f, 1.f, 0.f, 1.f, 1.f, 1.f, 1.f,
+      8.f, 8.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f
+    };
+    commandList.addTexturedTriangles(image, texturedValues, 3,
+                                     triangleIndexes, 3);
+
+    commandList.mergeCommands();
+  }
+
+  std::string writeToString(const cx::RenderCommandList& commandList)
+  {
+    std::stringstream stream;
+    commandList.write(stream);
+    return stream.str();
+  }
+}
+
+TEST_CASE("RenderCommandList round-trips a frame", "[RenderCommandList]")
+{
+  GPU_Image image = createImage();
+  cx::RenderCommandList commandList;
+  recordFrame(commandList, &image, 40.f);
+  REQUIRE(commandList.getNumMergedCommands() == 1);
+
+  std::stringstream stream{ writeToString(commandList) };
+  cx::RenderCommandList readList;
+  REQUIRE(readList.read(stream));
+  REQUIRE(readList.getNumCommands() == commandList.getNumCommands());
+  REQUIRE(readList.findFirstDifference(commandList) == -1);
+  REQUIRE(commandList.findFirstDifference(readList) == -1);
+
+  SECTION("Writing the read frame gives back the same bytes")
+  {
+    REQUIRE(writeToString(readList) == writeToString(commandList));
+  }
+
+  SECTION("Images are not replayed")
+  {
+    RecordingBackend backend;
+    commandList.execute(backend);
+    REQUIRE(backend.images
+            == eastl::vector<GPU_Image*>{ &image, &image, &image });
+
+    RecordingBackend replayBackend;
+    readList.execute(replayBackend);
+    REQUIRE(replayBackend.numCommands == backend.numCommands);
+    REQUIRE(replayBackend.images
+            == eastl::vector<GPU_Image*>{ nullptr, nullptr, nullptr });
+  }
+}
+
+TEST_CASE("RenderCommandList::findFirstDifference() finds changed commands",
+          "[RenderCommandList]")
+{
+  GPU_Image image = createImage();
+  cx::RenderCommandList commandList;
+  recordFrame(commandList, &image, 40.f);
+
+  // Only the circle moved.
+  cx::RenderCommandList otherList;
+  recordFrame(otherList, &image, 41.f);
+  REQUIRE(commandList.findFirstDifference(otherList) == 6);
+
+  // The lists match up until one of them runs out of commands.
+  otherList.clear();
+  recordFrame(otherList, &image, 40.f);
+  otherList.addClear(SDL_Color{ 0, 0, 0, 255 });
+  REQUIRE(commandList.findFirstDifference(otherList)
+          == commandList.getNumCommands());
+
+  otherList.clear();
+  REQUIRE(commandList.findFirstDifference(otherList) == 0);
+}
+
+TEST_CASE("RenderCommandList reads frames back to back", "[RenderCommandList]")
+{
+  GPU_Image image = createImage();
+  cx::RenderCommandList frame0;
+  cx::RenderCommandList frame1;
+  recordFrame(frame0, &image, 40.f);
+  recordFrame(frame1, &image, 60.f);
+
+  std::stringstream stream;
+  frame0.write(stream);
+  frame1.write(stream);
+
+  cx::RenderCommandList readList;
+  REQUIRE(readList.read(stream));
+  REQUIRE(readList.findFirstDifference(frame0) == -1);
+  REQUIRE(readList.read(stream));
+  REQUIRE(readList.findFirstDifference(frame1) == -1);
+  REQUIRE(!readList.read(stream));
+  REQUIRE(readList.getNumCommands() == 0);
+}
+
+TEST_CASE("RenderCommandList refuses bad data", "[RenderCommandList]")
+{
+  GPU_Image image = createImage();
+  cx::RenderCommandList commandList;
+  recordFrame(commandList, &image, 40.f);
+  const std::string data = writeToString(commandList);
+
+  cx::RenderCommandList readList;
+  recordFrame(readList, &image, 40.f);
+
+  SECTION("Truncated data")
+  {
+    // Cut off anywhere, including in the middle of a count.
+    for (size_t size : { size_t(0), size_t(2), size_t(40), data.size() - 1 }) {
+      CAPTURE(size);
+      std::stringstream stream{ data.substr(0, size) };
+      REQUIRE(!readList.read(stream));
+      REQUIRE(readList.getNumCommands() == 0);
+    }
+  }
+
+  SECTION("A count larger than the data left")
+  {
+    // The command count comes first. It would need gigabytes of commands.
+    std::string badData = data;
+    const int32_t numCommands = 0x7fffffff;
+    badData.replace(0, sizeof(numCommands),
+                    reinterpret_cast<const char*>(&numCommands),
+                    sizeof(numCommands));
+
+    std::stringstream stream{ badData };
+    REQUIRE(!readList.read(stream));
+    REQUIRE(readList.getNumCommands() == 0);
+  }
+
+  SECTION("A negative count")
+  {
+    std::string badData = data;
+    const int32_t numCommands = -1;
+    badData.replace(0, sizeof(numCommands),
+                    reinterpret_cast<const char*>(&numCommands),
+                    sizeof(numCommands));
+
+    std::stringstream stream{ badData };
+    REQUIRE(!readList.read(stream));
+    REQUIRE(readList.getNumCommands() == 0);
+  }
+
+  SECTION("Commands pointing past the data")
+  {
+    // Drop every vertex and index after the commands.
+    cx::RenderCommandList emptyList;
+    const std::string emptyData = writeToString(emptyList);
+    std::string badData = data.substr(0, sizeof(int32_t)
+                                         + (commandList.getNumCommands()
+                                            * sizeof(cx::RenderCommand)));
+    badData += emptyData.substr(sizeof(int32_t));
+
+    std::stringstream stream{ badData };
+    REQUIRE(!readList.read(stream));
+    REQUIRE(readList.getNumCommands() == 0);
+  }
+}
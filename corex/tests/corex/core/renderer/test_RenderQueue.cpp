@@ -0,0 +1,113 @@
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+#include <entt/entt.hpp>
+#include <SDL2/SDL.h>
+
+#include <corex/core/components/Position.hpp>
+#include <corex/core/components/Renderable.hpp>
+#include <corex/core/components/RenderableType.hpp>
+#include <corex/core/components/RenderCircle.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/renderer/RenderQueue.hpp>
+
+namespace
+{
+  const cx::AABB everywhere{ cx::Point{ -1000.f, -1000.f },
+                             cx::Point{ 1000.f, 1000.f } };
+
+  entt::entity createCircle(entt::registry& registry,
+                            float x,
+                            float y,
+                            float z,
+                            int8_t sortingLayerID)
+  {
+    entt::entity e = registry.create();
+    registry.emplace<cx::Position>(e, x, y, z, sortingLayerID);
+    registry.emplace<cx::RenderCircle>(e, 1.f, SDL_Color{ 0, 0, 0, 255 }, true);
+    registry.emplace<cx::Renderable>(e, cx::RenderableType::PRIMITIVE_CIRCLE);
+
+    return e;
+  }
+
+  eastl::vector<entt::entity> getEntities(
+    const eastl::vector<cx::RenderQueue::Item>& items)
+  {
+    eastl::vector<entt::entity> entities;
+    for (const cx::RenderQueue::Item& item : items) {
+      entities.push_back(item.entity);
+    }
+
+    return entities;
+  }
+}
+
+TEST_CASE("RenderQueue sorts by sorting layer and then by z", "[RenderQueue]")
+{
+  entt::registry registry;
+  cx::RenderQueue queue{ registry };
+
+  const entt::entity frontTop = createCircle(registry, 0.f, 0.f, 2.f, 1);
+  const entt::entity backTop = createCircle(registry, 0.f, 0.f, -3.f, 1);
+  const entt::entity bottom = createCircle(registry, 0.f, 0.f, 100.f, -1);
+  const entt::entity middleLow = createCircle(registry, 0.f, 0.f, -0.5f, 0);
+  const entt::entity middleHigh = createCircle(registry, 0.f, 0.f, 0.5f, 0);
+
+  const eastl::vector<entt::entity> expectedEntities{
+    bottom, middleLow, middleHigh, backTop, frontTop
+  };
+  REQUIRE(getEntities(queue.update(everywhere)) == expectedEntities);
+  REQUIRE(queue.size() == 5);
+  REQUIRE(queue.getNumVisibleItems() == 5);
+}
+
+TEST_CASE("RenderQueue picks up changes to positions and entities",
+          "[RenderQueue]")
+{
+  entt::registry registry;
+  cx::RenderQueue queue{ registry };
+
+  const entt::entity a = createCircle(registry, 0.f, 0.f, 0.f, 0);
+  const entt::entity b = createCircle(registry, 0.f, 0.f, 1.f, 0);
+  const entt::entity c = createCircle(registry, 0.f, 0.f, 2.f, 0);
+  REQUIRE(getEntities(queue.update(everywhere))
+          == eastl::vector<entt::entity>{ a, b, c });
+
+  // Positions are written to directly, without any signal.
+  registry.get<cx::Position>(a).z = 5.f;
+  REQUIRE(getEntities(queue.update(everywhere))
+          == eastl::vector<entt::entity>{ b, c, a });
+
+  registry.destroy(b);
+  const entt::entity d = createCircle(registry, 0.f, 0.f, -1.f, 0);
+  REQUIRE(getEntities(queue.update(everywhere))
+          == eastl::vector<entt::entity>{ d, c, a });
+}
+
+TEST_CASE("RenderQueue culls hidden entities and entities outside the view",
+          "[RenderQueue]")
+{
+  entt::registry registry;
+  cx::RenderQueue queue{ registry };
+
+  const entt::entity inside = createCircle(registry, 0.f, 0.f, 0.f, 0);
+  const entt::entity outside = createCircle(registry, 50.f, 0.f, 1.f, 0);
+
+  // Only the edge of this circle is in view, which is still enough.
+  const entt::entity onEdge = createCircle(registry, 10.5f, 0.f, 2.f, 0);
+  const entt::entity hidden = createCircle(registry, 0.f, 0.f, 3.f, 0);
+  registry.get<cx::Renderable>(hidden).isVisible = false;
+
+  const cx::AABB view{ cx::Point{ -10.f, -10.f }, cx::Point{ 10.f, 10.f } };
+  REQUIRE(getEntities(queue.update(view))
+          == eastl::vector<entt::entity>{ inside, onEdge });
+  REQUIRE(queue.size() == 4);
+  REQUIRE(queue.getNumVisibleItems() == 2);
+
+  // Culled entities keep their place in the draw order.
+  registry.get<cx::Renderable>(hidden).isVisible = true;
+  REQUIRE(getEntities(queue.update(everywhere))
+          == eastl::vector<entt::entity>{ inside, outside, onEdge, hidden });
+}
@@ -0,0 +1,88 @@
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+#include <EASTL/vector.h>
+#include <pcg_random.hpp>
+
+#include <corex/core/AliasTable.hpp>
+
+namespace
+{
+  eastl::vector<double> sampleFrequencies(const cx::AliasTable& table,
+                                          int32_t numSamples,
+                                          pcg32& rng)
+  {
+    eastl::vector<int32_t> sampledIndexes;
+    table.sample(numSamples, sampledIndexes, rng);
+
+    eastl::vector<double> frequencies(table.size(), 0.0);
+    for (int32_t index : sampledIndexes) {
+      REQUIRE(index >= 0);
+      REQUIRE(index < table.size());
+      frequencies[index] += 1.0 / numSamples;
+    }
+
+    return frequencies;
+  }
+}
+
+TEST_CASE("AliasTable samples according to the weights", "[AliasTable]")
+{
+  pcg32 rng{ 42u };
+  const eastl::vector<float> weights{ 1.f, 2.f, 3.f, 4.f };
+  const cx::AliasTable table{ weights };
+  REQUIRE(table.size() == 4);
+  REQUIRE_FALSE(table.isEmpty());
+
+  // With 200000 samples, the frequencies should be well within 1% of the
+  // expected probabilities.
+  const eastl::vector<double> frequencies = sampleFrequencies(table,
+                                                              200000,
+                                                              rng);
+  for (int32_t i = 0; i < weights.size(); i++) {
+    REQUIRE(frequencies[i] == Approx(weights[i] / 10.0).margin(0.01));
+  }
+}
+
+TEST_CASE("AliasTable never samples zero weights", "[AliasTable]")
+{
+  pcg32 rng{ 7u };
+  const cx::AliasTable table{ eastl::vector<float>{ 0.f, 5.f, 0.f, 1.f, 0.f } };
+  const eastl::vector<double> frequencies = sampleFrequencies(table,
+                                                              50000,
+                                                              rng);
+  REQUIRE(frequencies[0] == 0.0);
+  REQUIRE(frequencies[2] == 0.0);
+  REQUIRE(frequencies[4] == 0.0);
+  REQUIRE(frequencies[1] == Approx(5.0 / 6.0).margin(0.01));
+}
+
+TEST_CASE("AliasTable with a single weight", "[AliasTable]")
+{
+  pcg32 rng{ 1u };
+  const cx::AliasTable table{ eastl::vector<float>{ 0.25f } };
+  for (int32_t i = 0; i < 100; i++) {
+    REQUIRE(table.sample(rng) == 0);
+  }
+}
+
+TEST_CASE("AliasTable can be rebuilt with different weights",
+          "[AliasTable]")
+{
+  pcg32 rng{ 3u };
+  cx::AliasTable table;
+  REQUIRE(table.isEmpty());
+
+  table.build(eastl::vector<float>{ 1.f, 1.f, 1.f, 1.f, 1.f, 1.f });
+  REQUIRE(table.size() == 6);
+
+  // Nothing from the previous build should be left over.
+  table.build(eastl::vector<float>{ 3.f, 1.f });
+  REQUIRE(table.size() == 2);
+
+  const eastl::vector<double> frequencies = sampleFrequencies(table,
+                                                              50000,
+                                                              rng);
+  REQUIRE(frequencies[0] == Approx(0.75).margin(0.01));
+  REQUIRE(frequencies[1] == Approx(0.25).margin(0.01));
+}
@@ -0,0 +1,134 @@
+#include <catch2/catch.hpp>
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+
+#include <corex/core/PolygonClipper.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Rectangle.hpp>
+
+namespace
+{
+  // A 2x2 square with its bottom-left corner at the origin.
+  cx::NPolygon createSquare()
+  {
+    return cx::NPolygon{
+      {
+        cx::Point{ 0.f, 0.f }, cx::Point{ 2.f, 0.f }, cx::Point{ 2.f, 2.f },
+        cx::Point{ 0.f, 2.f }
+      }
+    };
+  }
+}
+
+TEST_CASE("PolygonClipper with overlapping polygons", "[PolygonClipper]")
+{
+  cx::NPolygon clippingPolygon = createSquare();
+  const cx::NPolygon shiftedSquare{
+    {
+      cx::Point{ 1.f, 1.f }, cx::Point{ 3.f, 1.f }, cx::Point{ 3.f, 3.f },
+      cx::Point{ 1.f, 3.f }
+    }
+  };
+
+  cx::NPolygon clippedPolygon;
+  {
+    cx::PolygonClipper clipper{ clippingPolygon };
+    REQUIRE(clipper.clip(shiftedSquare, clippedPolygon) == Approx(1.0));
+    REQUIRE(clippedPolygon.vertices.size() == 4);
+    for (const cx::Point& vertex : clippedPolygon.vertices) {
+      REQUIRE(vertex.x >= 1.f);
+      REQUIRE(vertex.x <= 2.f);
+      REQUIRE(vertex.y >= 1.f);
+      REQUIRE(vertex.y <= 2.f);
+    }
+  }
+
+  // The orientation of the clipping polygon must not matter.
+  eastl::reverse(clippingPolygon.vertices.begin(),
+                 clippingPolygon.vertices.end());
+  cx::PolygonClipper clipper{ clippingPolygon };
+  REQUIRE(clipper.clip(shiftedSquare, clippedPolygon) == Approx(1.0));
+  REQUIRE(clipper.computeOverlapArea(shiftedSquare) == Approx(1.0));
+}
+
+TEST_CASE("PolygonClipper with disjoint polygons", "[PolygonClipper]")
+{
+  cx::PolygonClipper clipper{ createSquare() };
+  const cx::NPolygon farSquare{
+    {
+      cx::Point{ 5.f, 5.f }, cx::Point{ 6.f, 5.f }, cx::Point{ 6.f, 6.f },
+      cx::Point{ 5.f, 6.f }
+    }
+  };
+
+  // Outside the clipping polygon, but inside its bounding box.
+  const cx::NPolygon cornerTriangle{
+    { cx::Point{ 1.9f, -1.f }, cx::Point{ 3.f, -1.f }, cx::Point{ 3.f, 0.f } }
+  };
+
+  cx::NPolygon clippedPolygon{ { cx::Point{ 1.f, 1.f } } };
+  REQUIRE(clipper.clip(farSquare, clippedPolygon) == 0.0);
+  REQUIRE(clippedPolygon.vertices.empty());
+  REQUIRE(clipper.computeOverlapArea(cornerTriangle) == Approx(0.0));
+
+  // Too few vertices to form a polygon.
+  const cx::NPolygon line{ { cx::Point{ 0.f, 0.f }, cx::Point{ 1.f, 1.f } } };
+  REQUIRE(clipper.computeOverlapArea(line) == 0.0);
+  REQUIRE(clipper.computeOverlapArea(cx::NPolygon{}) == 0.0);
+}
+
+TEST_CASE("PolygonClipper with a polygon inside the clipping polygon",
+          "[PolygonClipper]")
+{
+  cx::PolygonClipper clipper{ createSquare() };
+  const cx::NPolygon triangle{
+    {
+      cx::Point{ 0.5f, 0.5f }, cx::Point{ 1.5f, 0.5f },
+      cx::Point{ 0.5f, 1.5f }
+    }
+  };
+
+  cx::NPolygon clippedPolygon;
+  REQUIRE(clipper.clip(triangle, clippedPolygon) == Approx(0.5));
+  REQUIRE(clippedPolygon.vertices.size() == 3);
+}
+
+TEST_CASE("PolygonClipper with a concave subject polygon", "[PolygonClipper]")
+{
+  // Only the clipping polygon has to be convex. This L shape covers all of
+  // the clipping square except for its top-right 1x1 quarter.
+  cx::PolygonClipper clipper{ createSquare() };
+  const cx::NPolygon lShape{
+    {
+      cx::Point{ -1.f, -1.f }, cx::Point{ 3.f, -1.f }, cx::Point{ 3.f, 1.f },
+      cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 3.f }, cx::Point{ -1.f, 3.f }
+    }
+  };
+
+  REQUIRE(clipper.computeOverlapArea(lShape) == Approx(3.0));
+}
+
+TEST_CASE("PolygonClipper with rectangles", "[PolygonClipper]")
+{
+  // Rectangles are positioned by their center.
+  cx::PolygonClipper clipper{ cx::Rectangle{ 1.f, 1.f, 2.f, 2.f, 0.f } };
+  const eastl::vector<cx::Rectangle> rects{
+    cx::Rectangle{ 1.f, 1.f, 1.f, 1.f, 0.f },   // Inside. Area of 1.
+    cx::Rectangle{ 2.f, 1.f, 2.f, 2.f, 0.f },   // Half inside. Area of 2.
+    cx::Rectangle{ 10.f, 10.f, 1.f, 1.f, 0.f }  // Outside.
+  };
+
+  eastl::vector<double> overlapAreas;
+  REQUIRE(clipper.clipRectangles(rects, overlapAreas) == Approx(3.0));
+  REQUIRE(overlapAreas.size() == 3);
+  REQUIRE(overlapAreas[0] == Approx(1.0));
+  REQUIRE(overlapAreas[1] == Approx(2.0));
+  REQUIRE(overlapAreas[2] == 0.0);
+
+  eastl::vector<cx::NPolygon> clippedPolygons;
+  REQUIRE(clipper.clipRectangles(rects, clippedPolygons, overlapAreas)
+          == Approx(3.0));
+  REQUIRE(clippedPolygons.size() == 3);
+  REQUIRE(clippedPolygons[2].vertices.empty());
+}
@@ -0,0 +1,80 @@
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+
+#include <corex/core/PolygonSampler.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+
+TEST_CASE("PolygonSampler samples from inside the polygon",
+          "[PolygonSampler]")
+{
+  // An L shape, so that samples from the notch would be caught.
+  const cx::PolygonSampler sampler{
+    cx::NPolygon{
+      {
+        cx::Point{ 0.f, 0.f }, cx::Point{ 4.f, 0.f }, cx::Point{ 4.f, 1.f },
+        cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 4.f }, cx::Point{ 0.f, 4.f }
+      }
+    }
+  };
+  REQUIRE(sampler.getArea() == Approx(7.0));
+
+  eastl::vector<cx::Point> samples;
+  sampler.sample(1000, samples);
+  REQUIRE(samples.size() == 1000);
+  for (const cx::Point& sample : samples) {
+    const bool isInBottomArm = sample.x >= 0.f && sample.x <= 4.f
+                               && sample.y >= 0.f && sample.y <= 1.f;
+    const bool isInLeftArm = sample.x >= 0.f && sample.x <= 1.f
+                             && sample.y >= 0.f && sample.y <= 4.f;
+    REQUIRE((isInBottomArm || isInLeftArm));
+  }
+}
+
+TEST_CASE("PolygonSampler with a polygon that has no area",
+          "[PolygonSampler]")
+{
+  // A bounding box with no width, which is just a vertical line.
+  const cx::PolygonSampler sampler{
+    cx::NPolygon{
+      {
+        cx::Point{ 2.f, -1.f }, cx::Point{ 2.f, -1.f }, cx::Point{ 2.f, 3.f },
+        cx::Point{ 2.f, 3.f }
+      }
+    }
+  };
+  REQUIRE(sampler.getArea() == 0.0);
+
+  eastl::vector<cx::Point> samples;
+  sampler.sample(1000, samples);
+  float minY = samples[0].y;
+  float maxY = samples[0].y;
+  for (const cx::Point& sample : samples) {
+    REQUIRE(sample.x == Approx(2.f));
+    REQUIRE(sample.y >= -1.f);
+    REQUIRE(sample.y <= 3.f);
+
+    minY = eastl::min(minY, sample.y);
+    maxY = eastl::max(maxY, sample.y);
+  }
+
+  // The samples should be spread along the whole line.
+  REQUIRE(minY < 0.f);
+  REQUIRE(maxY > 2.f);
+
+  // A box with neither width nor height is a single point.
+  const cx::PolygonSampler pointSampler{
+    cx::NPolygon{
+      {
+        cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 1.f },
+        cx::Point{ 1.f, 1.f }
+      }
+    }
+  };
+  const cx::Point sample = pointSampler.sample();
+  REQUIRE(sample.x == 1.f);
+  REQUIRE(sample.y == 1.f);
+}
@@ -0,0 +1,310 @@
+#include <cmath>
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+#include <EASTL/algorithm.h>
+#include <EASTL/vector.h>
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/PolygonClipper.hpp>
+#include <corex/core/ds/NPolygon.hpp>
+#include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/PreparedPolygon.hpp>
+#include <corex/core/ds/Vec2.hpp>
+
+namespace
+{
+  template <class P>
+  double getSignedArea(const P& polygon)
+  {
+    const auto& vertices = polygon.vertices;
+    const int32_t numVertices = vertices.size();
+    double area = 0.0;
+    for (int32_t i = 0, j = numVertices - 1; i < numVertices; j = i++) {
+      area += (static_cast<double>(vertices[j].x) * vertices[i].y)
+              - (static_cast<double>(vertices[i].x) * vertices[j].y);
+    }
+
+    return area / 2.0;
+  }
+
+  void requireValidTriangulation(
+    const cx::NPolygon& polygon,
+    const eastl::vector<cx::Polygon<3>>& triangles)
+  {
+    REQUIRE(triangles.size() == polygon.vertices.size() - 2);
+
+    // The triangles must cover the polygon exactly once, and keep the winding
+    // of the polygon. A flipped triangle would cancel out part of the area.
+    const double polygonArea = getSignedArea(polygon);
+    double trianglesArea = 0.0;
+    for (const cx::Polygon<3>& triangle : triangles) {
+      const double triangleArea = getSignedArea(triangle);
+      REQUIRE(triangleArea * polygonArea >= 0.0);
+
+      trianglesArea += triangleArea;
+    }
+
+    REQUIRE(trianglesArea == Approx(polygonArea));
+  }
+
+  // Every normal must be a unit vector that points away from the polygon.
+  void requireOutwardEdgeNormals(const cx::PreparedPolygon& preparedPolygon)
+  {
+    const auto& vertices = preparedPolygon.polygon.vertices;
+    const int32_t numVertices = vertices.size();
+    REQUIRE(preparedPolygon.edgeNormals.size() == numVertices);
+    for (int32_t i = 0; i < numVertices; i++) {
+      CAPTURE(i);
+      const cx::Vec2& normal = preparedPolygon.edgeNormals[i];
+      REQUIRE(cx::vec2Magnitude(normal) == Approx(1.f));
+
+      const cx::Point midpoint = (vertices[i]
+                                  + vertices[(i + 1) % numVertices]) / 2.f;
+      REQUIRE(!cx::isPointWithinNPolygon(midpoint + (normal * 0.01f),
+                                         preparedPolygon.polygon));
+      REQUIRE(cx::isPointWithinNPolygon(midpoint - (normal * 0.01f),
+                                        preparedPolygon.polygon));
+    }
+  }
+
+  // The prepared polygon must give the same answers as the plain one. The
+  // grid is offset so that no point lands right on an edge.
+  void requireSamePointTests(const cx::PreparedPolygon& preparedPolygon)
+  {
+    for (int32_t i = 0; i < 30; i++) {
+      for (int32_t j = 0; j < 30; j++) {
+        const cx::Point point{ -2.53f + (i * 0.25f), -2.53f + (j * 0.25f) };
+        CAPTURE(point.x, point.y);
+        REQUIRE(cx::isPointWithinNPolygon(point, preparedPolygon)
+                == cx::isPointWithinNPolygon(point, preparedPolygon.polygon));
+      }
+    }
+  }
+}
+
+TEST_CASE("earClipTriangulate() with too few vertices", "[math_functions]")
+{
+  REQUIRE(cx::earClipTriangulate(cx::NPolygon{}).empty());
+  REQUIRE(cx::earClipTriangulate(
+    cx::NPolygon{ { cx::Point{ 0.f, 0.f }, cx::Point{ 1.f, 0.f } } }).empty());
+
+  // Results from a previous call must not leak into the next one.
+  eastl::vector<cx::Polygon<3>> triangles(4);
+  cx::earClipTriangulate(cx::NPolygon{}, triangles);
+  REQUIRE(triangles.empty());
+}
+
+TEST_CASE("earClipTriangulate() with a convex polygon", "[math_functions]")
+{
+  const cx::NPolygon triangle{
+    { cx::Point{ 0.f, 0.f }, cx::Point{ 4.f, 0.f }, cx::Point{ 0.f, 3.f } }
+  };
+  requireValidTriangulation(triangle, cx::earClipTriangulate(triangle));
+
+  const cx::NPolygon hexagon{
+    {
+      cx::Point{ 2.f, 0.f }, cx::Point{ 1.f, 1.7f }, cx::Point{ -1.f, 1.7f },
+      cx::Point{ -2.f, 0.f }, cx::Point{ -1.f, -1.7f }, cx::Point{ 1.f, -1.7f }
+    }
+  };
+  requireValidTriangulation(hexagon, cx::earClipTriangulate(hexagon));
+}
+
+TEST_CASE("earClipTriangulate() with concave polygons", "[math_functions]")
+{
+  // An L shape.
+  cx::NPolygon lShape{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 4.f, 0.f }, cx::Point{ 4.f, 1.f },
+      cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 4.f }, cx::Point{ 0.f, 4.f }
+    }
+  };
+
+  // A comb with three teeth, which has several reflex vertices in a row.
+  cx::NPolygon comb{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 5.f, 0.f }, cx::Point{ 5.f, 3.f },
+      cx::Point{ 4.f, 3.f }, cx::Point{ 4.f, 1.f }, cx::Point{ 3.f, 1.f },
+      cx::Point{ 3.f, 3.f }, cx::Point{ 2.f, 3.f }, cx::Point{ 2.f, 1.f },
+      cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 3.f }, cx::Point{ 0.f, 3.f }
+    }
+  };
+
+  for (cx::NPolygon* polygon : { &lShape, &comb }) {
+    requireValidTriangulation(*polygon, cx::earClipTriangulate(*polygon));
+
+    // The triangles must stay inside the polygon, so that none of them spans
+    // a notch.
+    for (const cx::Polygon<3>& triangle : cx::earClipTriangulate(*polygon)) {
+      const cx::Point centroid = (triangle.vertices[0]
+                                  + triangle.vertices[1]
+                                  + triangle.vertices[2]) / 3.f;
+      REQUIRE(cx::isPointWithinNPolygon(centroid, *polygon));
+    }
+
+    // Both windings must work.
+    eastl::reverse(polygon->vertices.begin(), polygon->vertices.end());
+    requireValidTriangulation(*polygon, cx::earClipTriangulate(*polygon));
+  }
+}
+
+TEST_CASE("earClipTriangulate() with collinear vertices", "[math_functions]")
+{
+  // A square with an extra vertex in the middle of each edge.
+  const cx::NPolygon square{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 1.f, 0.f }, cx::Point{ 2.f, 0.f },
+      cx::Point{ 2.f, 1.f }, cx::Point{ 2.f, 2.f }, cx::Point{ 1.f, 2.f },
+      cx::Point{ 0.f, 2.f }, cx::Point{ 0.f, 1.f }
+    }
+  };
+  requireValidTriangulation(square, cx::earClipTriangulate(square));
+
+  // Every vertex on a single line. There is nothing to cover, but we still
+  // have to terminate with the right number of triangles.
+  const cx::NPolygon line{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 1.f, 1.f }, cx::Point{ 2.f, 2.f },
+      cx::Point{ 3.f, 3.f }
+    }
+  };
+  requireValidTriangulation(line, cx::earClipTriangulate(line));
+}
+
+TEST_CASE("earClipTriangulate() with a prepared polygon", "[math_functions]")
+{
+  const cx::NPolygon lShape{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 4.f, 0.f }, cx::Point{ 4.f, 1.f },
+      cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 4.f }, cx::Point{ 0.f, 4.f }
+    }
+  };
+  const cx::PreparedPolygon preparedLShape = cx::preparePolygon(lShape);
+  requireValidTriangulation(lShape,
+                             cx::earClipTriangulate(preparedLShape));
+}
+
+TEST_CASE("preparePolygon() caches the polygon's properties",
+          "[math_functions]")
+{
+  cx::NPolygon lShape{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 4.f, 0.f }, cx::Point{ 4.f, 1.f },
+      cx::Point{ 1.f, 1.f }, cx::Point{ 1.f, 4.f }, cx::Point{ 0.f, 4.f }
+    }
+  };
+
+  // Both windings must give the same polygon, apart from the winding.
+  for (bool isReversed : { false, true }) {
+    CAPTURE(isReversed);
+    if (isReversed) {
+      eastl::reverse(lShape.vertices.begin(), lShape.vertices.end());
+    }
+
+    const cx::PreparedPolygon preparedLShape = cx::preparePolygon(lShape);
+    REQUIRE(preparedLShape.polygon.vertices == lShape.vertices);
+    REQUIRE(preparedLShape.isCounterclockwise
+            == (getSignedArea(lShape) >= 0.0));
+    REQUIRE(preparedLShape.area == Approx(7.0));
+
+    // A 4 by 1 bar and a 1 by 3 bar.
+    REQUIRE(preparedLShape.centroid.x == Approx(9.5f / 7.f));
+    REQUIRE(preparedLShape.centroid.y == Approx(9.5f / 7.f));
+
+    REQUIRE(preparedLShape.bounds.minPt.x == 0.f);
+    REQUIRE(preparedLShape.bounds.minPt.y == 0.f);
+    REQUIRE(preparedLShape.bounds.maxPt.x == 4.f);
+    REQUIRE(preparedLShape.bounds.maxPt.y == 4.f);
+
+    requireOutwardEdgeNormals(preparedLShape);
+
+    // Only the inner corner is reflex.
+    const int32_t innerCornerIndex = isReversed ? 2 : 3;
+    REQUIRE(!preparedLShape.isConvex);
+    for (int32_t i = 0; i < lShape.vertices.size(); i++) {
+      CAPTURE(i);
+      const bool isInnerCorner = (i == innerCornerIndex);
+      REQUIRE(preparedLShape.isReflex[i] == isInnerCorner);
+      REQUIRE(preparedLShape.interiorAngles[i]
+              == Approx(isInnerCorner ? 270.f : 90.f));
+    }
+
+    requireSamePointTests(preparedLShape);
+  }
+}
+
+TEST_CASE("preparePolygon() with convex polygons", "[math_functions]")
+{
+  const cx::NPolygon hexagon{
+    {
+      cx::Point{ 2.f, 0.f }, cx::Point{ 1.f, 1.7f }, cx::Point{ -1.f, 1.7f },
+      cx::Point{ -2.f, 0.f }, cx::Point{ -1.f, -1.7f }, cx::Point{ 1.f, -1.7f }
+    }
+  };
+  const cx::PreparedPolygon preparedHexagon = cx::preparePolygon(hexagon);
+  REQUIRE(preparedHexagon.isConvex);
+  REQUIRE(preparedHexagon.area == Approx(fabs(getSignedArea(hexagon))));
+  REQUIRE(preparedHexagon.centroid.x == Approx(0.f).margin(1e-6));
+  REQUIRE(preparedHexagon.centroid.y == Approx(0.f).margin(1e-6));
+  requireOutwardEdgeNormals(preparedHexagon);
+  requireSamePointTests(preparedHexagon);
+
+  // A vertex in the middle of an edge makes a straight angle. The ear
+  // clipper counts it as reflex, but the polygon is still convex.
+  const cx::NPolygon square{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 1.f, 0.f }, cx::Point{ 2.f, 0.f },
+      cx::Point{ 2.f, 2.f }, cx::Point{ 0.f, 2.f }
+    }
+  };
+  const cx::PreparedPolygon preparedSquare = cx::preparePolygon(square);
+  REQUIRE(preparedSquare.isConvex);
+  REQUIRE(preparedSquare.interiorAngles[1] == Approx(180.f));
+  REQUIRE(preparedSquare.isReflex[1]);
+  REQUIRE(preparedSquare.area == Approx(4.0));
+  REQUIRE(preparedSquare.centroid.x == Approx(1.f));
+  REQUIRE(preparedSquare.centroid.y == Approx(1.f));
+  requireOutwardEdgeNormals(preparedSquare);
+  requireSamePointTests(preparedSquare);
+
+  // Convex polygons can be used to clip with.
+  cx::PolygonClipper clipper{ preparedSquare };
+  REQUIRE(clipper.computeOverlapArea(square) == Approx(4.0));
+}
+
+TEST_CASE("preparePolygon() with degenerate polygons", "[math_functions]")
+{
+  // No area, so the centroid is the average of the vertices.
+  const cx::NPolygon line{
+    { cx::Point{ 0.f, 0.f }, cx::Point{ 1.f, 0.f }, cx::Point{ 2.f, 0.f } }
+  };
+  const cx::PreparedPolygon preparedLine = cx::preparePolygon(line);
+  REQUIRE(preparedLine.area == 0.0);
+  REQUIRE(preparedLine.centroid.x == Approx(1.f));
+  REQUIRE(preparedLine.centroid.y == 0.f);
+  REQUIRE(preparedLine.bounds.minPt.x == 0.f);
+  REQUIRE(preparedLine.bounds.maxPt.x == 2.f);
+  for (const cx::Vec2& normal : preparedLine.edgeNormals) {
+    REQUIRE(cx::vec2Magnitude(normal) == Approx(1.f));
+  }
+
+  // A repeated vertex makes an edge with no length, which gets no normal.
+  const cx::NPolygon square{
+    {
+      cx::Point{ 0.f, 0.f }, cx::Point{ 2.f, 0.f }, cx::Point{ 2.f, 0.f },
+      cx::Point{ 2.f, 2.f }, cx::Point{ 0.f, 2.f }
+    }
+  };
+  const cx::PreparedPolygon preparedSquare = cx::preparePolygon(square);
+  REQUIRE(preparedSquare.area == Approx(4.0));
+  REQUIRE(preparedSquare.centroid.x == Approx(1.f));
+  REQUIRE(preparedSquare.centroid.y == Approx(1.f));
+  for (int32_t i = 0; i < square.vertices.size(); i++) {
+    CAPTURE(i);
+    const float normalLength = cx::vec2Magnitude(
+      preparedSquare.edgeNormals[i]);
+    REQUIRE(normalLength == Approx((i == 1) ? 0.f : 1.f));
+  }
+}
@@ -2,61 +2,140 @@
 #include <array>
 #include <cmath>
 #include <cstdlib>
-#include <iostream>
+#include <limits>
+#include <utility>
 #include <vector>
 
 #include <corex/core/math_functions.hpp>
+#include <corex/core/PolygonSampler.hpp>
+#include <corex/core/ds/NPolygon.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
+#include <corex/core/memory/allocation_tracking.hpp>
+#include <corex/core/memory/LinearArena.hpp>
 
 #include <gwo_viz/GWO.hpp>
+#include <gwo_viz/GWOMetrics.hpp>
 #include <gwo_viz/GWOResult.hpp>
 
 namespace gwo_viz
 {
+  // Functions and that should only be accessible here.
+  // Returns the indexes of the three fittest wolves, fittest first. The pack
+  // itself is left in place, so that every wolf keeps its index.
+  std::array<int32_t, 3> _findLeaderIndexes(const cx::Point* pack,
+                                            int32_t numWolves,
+                                            cx::Point bestSolution)
+  {
+    std::array<int32_t, 3> leaderIndexes{ 0, 0, 0 };
+    std::array<float, 3> leaderFitnesses;
+    leaderFitnesses.fill(std::numeric_limits<float>::infinity());
+
+    for (int32_t i = 0; i < numWolves; i++) {
+      const float fitness = std::fabs(cx::distance2D(bestSolution, pack[i]));
+      if (!(fitness < leaderFitnesses[2])) {
+        continue;
+      }
+
+      // Insert the wolf into the leaders, pushing the less fit ones down.
+      int32_t rank = 2;
+      while (rank > 0 && fitness < leaderFitnesses[rank - 1]) {
+        leaderFitnesses[rank] = leaderFitnesses[rank - 1];
+        leaderIndexes[rank] = leaderIndexes[rank - 1];
+        rank--;
+      }
+
+      leaderFitnesses[rank] = fitness;
+      leaderIndexes[rank] = i;
+    }
+
+    return leaderIndexes;
+  }
+  /////////////////////////////////////////////////
+
   GWO::GWO()
-    : numItersPerformed(0) {}
+    : numItersPerformed(0)
+    , runArena(64 * 1024, "GWO Run Arena") {}
 
   GWOResult GWO::optimize(int32_t numIterations,
                           int32_t numWolves,
                           cx::Point bestSolution,
                           cx::Point minPt,
-                          cx::Point maxPt)
+                          cx::Point maxPt,
+                          GWOMetrics* metrics)
   {
-    GWO::Solutions solutions;
-    std::vector<cx::Point> wolfPreys;
-
-    std::vector<cx::Point> pack;
-    for (int32_t i = 0; i < numWolves; i++) {
-      float x = cx::getRandomRealUniformly(minPt.x, maxPt.x);
-      float y = cx::getRandomRealUniformly(minPt.y, maxPt.y);
+    cx::NPolygon boundingArea{
+      {
+        minPt,
+        cx::Point{ maxPt.x, minPt.y },
+        maxPt,
+        cx::Point{ minPt.x, maxPt.y }
+      }
+    };
 
-      pack.emplace_back(x, y);
-    }
+    return this->optimize(numIterations,
+                          numWolves,
+                          bestSolution,
+                          boundingArea,
+                          metrics);
+  }
 
-    std::sort(
-      pack.begin(),
-      pack.end(),
-      [&bestSolution](const cx::Point& a, const cx::Point& b) {
-        float aFitness = std::fabs(cx::distance2D(bestSolution, a));
-        float bFitness = std::fabs(cx::distance2D(bestSolution, b));
+  GWOResult GWO::optimize(int32_t numIterations,
+                          int32_t numWolves,
+                          cx::Point bestSolution,
+                          const cx::NPolygon& boundingArea,
+                          GWOMetrics* metrics)
+  {
+    COREX_ALLOCATION_SCOPE("GWO");
 
-        return aFitness < bFitness;
-      });
+    this->runArena.reset();
+    this->numItersPerformed = 0;
 
-    cx::Point alphaWolf = pack[0];
-    cx::Point betaWolf = pack[1];
-    cx::Point deltaWolf = pack[2];
+    // Counts come straight from the UI, so they can be negative. There are
+    // no leaders to follow without any wolves.
+    numIterations = std::max(numIterations, 0);
+    numWolves = std::max(numWolves, 0);
+    if (numWolves == 0) {
+      return GWOResult{};
+    }
 
-    solutions.push_back(pack);
+    // The solutions of every iteration are kept, and handed over in the
+    // result, so allocate space for all of them upfront. Only the pack is
+    // scratch memory for the run.
+    cx::PointHistory solutions{ numWolves, numIterations + 1 };
+    std::vector<std::array<int32_t, 3>> leaderIndexes;
+    std::vector<cx::Point> wolfPreys;
+    leaderIndexes.reserve(numIterations + 1);
+    wolfPreys.reserve(numIterations + 1);
+
+    cx::PolygonSampler boundingAreaSampler{ boundingArea };
+    cx::Point* pack = this->runArena.allocateArray<cx::Point>(numWolves);
+    boundingAreaSampler.sample(numWolves, pack);
+
+    // The leaders are picked out instead of sorting the pack, so that wolves
+    // can be followed across iterations.
+    std::array<int32_t, 3> leaders = _findLeaderIndexes(pack,
+                                                        numWolves,
+                                                        bestSolution);
+    cx::Point alphaWolf = pack[leaders[0]];
+    cx::Point betaWolf = pack[leaders[1]];
+    cx::Point deltaWolf = pack[leaders[2]];
+
+    solutions.addFrame(pack);
+    leaderIndexes.push_back(leaders);
     wolfPreys.push_back((alphaWolf + betaWolf + deltaWolf) / 3.f);
 
-    this->numItersPerformed = 0;
+    // Metrics only look at the current pack, so they cost the same at every
+    // iteration, no matter how long the run is.
+    if (metrics != nullptr) {
+      metrics->add(pack, numWolves, bestSolution, wolfPreys.back());
+    }
 
     float a = 2.f;
     for (int32_t t = 0; t < numIterations; t++) {
-      alphaWolf = pack[0];
-      betaWolf = pack[1];
-      deltaWolf = pack[2];
+      alphaWolf = pack[leaders[0]];
+      betaWolf = pack[leaders[1]];
+      deltaWolf = pack[leaders[2]];
 
       std::array<cx::Point, 3> Al;
       std::array<cx::Point, 3> Cl;
@@ -75,36 +154,11 @@ namespace gwo_viz
         Cl[n].y = 2 * r2l[n].y;
       }
 
-      std::cout << "Al: "
-                << "(" << Al[0].x << ", " << Al[0].y << ") "
-                << "(" << Al[1].x << ", " << Al[1].y << ") "
-                << "(" << Al[2].x << ", " << Al[2].y << ")\n";
-      std::cout << "Cl: "
-                << "(" << Cl[0].x << ", " << Cl[0].y << ") "
-                << "(" << Cl[1].x << ", " << Cl[1].y << ") "
-                << "(" << Cl[2].x << ", " << Cl[2].y << ")\n";
-
-      for (int32_t j = 3; j < numWolves; j++) {
-        std::cout << "------" << j << "-------\n";
-        std::cout << "Wolves: "
-                  << "A: (" << alphaWolf.x << ", " << alphaWolf.y << ") "
-                  << "B: (" << betaWolf.x  << ", " << betaWolf.y << ") "
-                  << "D: (" << deltaWolf.x << ", " << deltaWolf.y << ")\n";
-        // Generate the coefficient values.
-        cx::Point Aw;
-        cx::Point Cw;
-        cx::Point r1w;
-        cx::Point r2w;
-
-        r1w.x = cx::getRandomRealUniformly(0.f, 1.f);
-        r1w.y = cx::getRandomRealUniformly(0.f, 1.f);
-        r2w.x = cx::getRandomRealUniformly(0.f, 1.f);
-        r2w.y = cx::getRandomRealUniformly(0.f, 1.f);
-
-        Aw.x = (2 * a * r1w.x) - a;
-        Aw.y = (2 * a * r1w.y) - a;
-        Cw.x = 2 * r2w.x;
-        Cw.y = 2 * r2w.y;
+      for (int32_t j = 0; j < numWolves; j++) {
+        // The leaders stay where they are.
+        if (j == leaders[0] || j == leaders[1] || j == leaders[2]) {
+          continue;
+        }
 
         auto wolf = pack[j];
 
@@ -117,35 +171,18 @@ namespace gwo_viz
         auto X3 = deltaWolf - cx::pairwiseMult(Al[2], Dd);
 
         pack[j] = (X1 + X2 + X3) / 3.f;
-
-        std::cout << "Aw: "
-                  << "(" << Aw.x << ", " << Aw.y << ")\n";
-        std::cout << "Cw: "
-                  << "(" << Cw.x << ", " << Cw.y << ")\n";
-        std::cout << "Da: "
-                  << "(" << Da.x << ", " << Da.y << ")\n";
-        std::cout << "Db: "
-                  << "(" << Db.x << ", " << Db.y << ")\n";
-        std::cout << "Dd: "
-                  << "(" << Dd.x << ", " << Dd.y << ")\n";
-        std::cout << "X1: (" << X1.x << ", " << X1.y << ")\n";
-        std::cout << "X2: (" << X2.x << ", " << X2.y << ")\n";
-        std::cout << "X3: (" << X3.x << ", " << X3.y << ")\n";
-        std::cout << "Wolf: (" << pack[j].x << ", " << pack[j].y << ")\n";
       }
 
-      std::sort(
-        pack.begin(),
-        pack.end(),
-        [&bestSolution](const cx::Point& a, const cx::Point& b) {
-          float aFitness = std::fabs(cx::distance2D(bestSolution, a));
-          float bFitness = std::fabs(cx::distance2D(bestSolution, b));
+      leaders = _findLeaderIndexes(pack, numWolves, bestSolution);
+      solutions.addFrame(pack);
+      leaderIndexes.push_back(leaders);
 
-          return aFitness < bFitness;
-        });
-      solutions.push_back(pack);
+      wolfPreys.push_back(
+        (pack[leaders[0]] + pack[leaders[1]] + pack[leaders[2]]) / 3.f);
 
-      wolfPreys.push_back((pack[0] + pack[1] + pack[2]) / 3.f);
+      if (metrics != nullptr) {
+        metrics->add(pack, numWolves, bestSolution, wolfPreys.back());
+      }
 
       a = 2.f - (2.f * (static_cast<float>(t) / numIterations));
 
@@ -153,8 +190,9 @@ namespace gwo_viz
     }
 
     return GWOResult{
-      solutions,
-      wolfPreys
+      std::move(solutions),
+      std::move(leaderIndexes),
+      std::move(wolfPreys)
     };
   }
 
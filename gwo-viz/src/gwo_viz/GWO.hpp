@@ -1,12 +1,14 @@
 #ifndef GWOVIZ_GWO_HPP
 #define GWOVIZ_GWO_HPP
 
+#include <atomic>
 #include <cstdlib>
 
-#include <vector>
-
+#include <corex/core/ds/NPolygon.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/memory/LinearArena.hpp>
 
+#include <gwo_viz/GWOMetrics.hpp>
 #include <gwo_viz/GWOResult.hpp>
 
 namespace gwo_viz
@@ -16,17 +18,30 @@ namespace gwo_viz
   public:
     GWO();
 
-    using Solutions = std::vector<std::vector<cx::Point>>;
+    // If given, the metrics of every iteration get added to metrics as the
+    // run goes. The metrics must have been reset for the run beforehand.
     GWOResult optimize(int32_t numIterations,
                        int32_t numWolves,
                        cx::Point bestSolution,
                        cx::Point minPt,
-                       cx::Point maxPt);
+                       cx::Point maxPt,
+                       GWOMetrics* metrics = nullptr);
+
+    // Initial wolf positions are sampled uniformly from inside the bounding
+    // area, which may be concave.
+    GWOResult optimize(int32_t numIterations,
+                       int32_t numWolves,
+                       cx::Point bestSolution,
+                       const cx::NPolygon& boundingArea,
+                       GWOMetrics* metrics = nullptr);
 
     int32_t getNumItersPerformed();
   private:
-    int32_t numItersPerformed;
-    std::vector<std::vector<cx::Point>> solutions;
+    std::atomic<int32_t> numItersPerformed; // Read while a run is going on.
+
+    // Scratch memory for a single optimization run. Reset at the start of
+    // every run.
+    cx::LinearArena runArena;
   };
 }
 
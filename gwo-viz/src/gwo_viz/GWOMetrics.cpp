@@ -0,0 +1,327 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GWOVIZ_GWO_METRICS_USE_SSE2
+#endif
+
+#include <corex/core/math_functions.hpp>
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+
+#include <gwo_viz/GWOMetrics.hpp>
+
+namespace gwo_viz
+{
+  // Functions and that should only be accessible here.
+  static_assert(sizeof(cx::Point) == sizeof(float) * 2,
+                "Reductions assume that points are packed x, y pairs.");
+
+  namespace
+  {
+    // Running totals of the first pass over the pack.
+    struct PackTotals
+    {
+      float fitnessSum;
+      float minFitness;
+      float maxFitness;
+      cx::Point positionSum;
+      cx::AABB bounds;
+    };
+  }
+
+  void _addPackTotalsScalar(const cx::Point* wolves,
+                            int32_t numWolves,
+                            cx::Point bestSolution,
+                            PackTotals& totals)
+  {
+    for (int32_t i = 0; i < numWolves; i++) {
+      const cx::Point& wolf = wolves[i];
+      const float dx = wolf.x - bestSolution.x;
+      const float dy = wolf.y - bestSolution.y;
+      const float fitness = std::sqrt((dx * dx) + (dy * dy));
+
+      totals.fitnessSum += fitness;
+      totals.minFitness = std::min(totals.minFitness, fitness);
+      totals.maxFitness = std::max(totals.maxFitness, fitness);
+      totals.positionSum.x += wolf.x;
+      totals.positionSum.y += wolf.y;
+      totals.bounds.minPt.x = std::min(totals.bounds.minPt.x, wolf.x);
+      totals.bounds.minPt.y = std::min(totals.bounds.minPt.y, wolf.y);
+      totals.bounds.maxPt.x = std::max(totals.bounds.maxPt.x, wolf.x);
+      totals.bounds.maxPt.y = std::max(totals.bounds.maxPt.y, wolf.y);
+    }
+  }
+
+  float _getMaxSquaredDistScalar(const cx::Point* wolves,
+                                 int32_t numWolves,
+                                 cx::Point centre,
+                                 float maxSquaredDist)
+  {
+    for (int32_t i = 0; i < numWolves; i++) {
+      const float dx = wolves[i].x - centre.x;
+      const float dy = wolves[i].y - centre.y;
+      maxSquaredDist = std::max(maxSquaredDist, (dx * dx) + (dy * dy));
+    }
+
+    return maxSquaredDist;
+  }
+
+#ifdef GWOVIZ_GWO_METRICS_USE_SSE2
+  // Splits four packed points into their x's and y's.
+  void _loadPointsSSE2(const cx::Point* points, __m128& xs, __m128& ys)
+  {
+    const float* values = reinterpret_cast<const float*>(points);
+    const __m128 firstPair = _mm_loadu_ps(values);
+    const __m128 secondPair = _mm_loadu_ps(values + 4);
+    xs = _mm_shuffle_ps(firstPair, secondPair, _MM_SHUFFLE(2, 0, 2, 0));
+    ys = _mm_shuffle_ps(firstPair, secondPair, _MM_SHUFFLE(3, 1, 3, 1));
+  }
+
+  float _getLaneSum(__m128 values)
+  {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, values);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+
+  float _getLaneMin(__m128 values)
+  {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, values);
+    return std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+  }
+
+  float _getLaneMax(__m128 values)
+  {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, values);
+    return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+  }
+
+  // Reduces four wolves at a time, with a running total per lane. Returns the
+  // number of wolves that got reduced.
+  int32_t _addPackTotalsSSE2(const cx::Point* wolves,
+                             int32_t numWolves,
+                             cx::Point bestSolution,
+                             PackTotals& totals)
+  {
+    const int32_t numBatchedWolves = numWolves - (numWolves % 4);
+    if (numBatchedWolves == 0) {
+      return 0;
+    }
+
+    const __m128 bestXs = _mm_set1_ps(bestSolution.x);
+    const __m128 bestYs = _mm_set1_ps(bestSolution.y);
+    __m128 fitnessSums = _mm_setzero_ps();
+    __m128 minFitnesses = _mm_set1_ps(totals.minFitness);
+    __m128 maxFitnesses = _mm_set1_ps(totals.maxFitness);
+    __m128 xSums = _mm_setzero_ps();
+    __m128 ySums = _mm_setzero_ps();
+    __m128 minXs = _mm_set1_ps(totals.bounds.minPt.x);
+    __m128 minYs = _mm_set1_ps(totals.bounds.minPt.y);
+    __m128 maxXs = _mm_set1_ps(totals.bounds.maxPt.x);
+    __m128 maxYs = _mm_set1_ps(totals.bounds.maxPt.y);
+    for (int32_t i = 0; i < numBatchedWolves; i += 4) {
+      __m128 xs;
+      __m128 ys;
+      _loadPointsSSE2(wolves + i, xs, ys);
+
+      const __m128 dxs = _mm_sub_ps(xs, bestXs);
+      const __m128 dys = _mm_sub_ps(ys, bestYs);
+      const __m128 fitnesses = _mm_sqrt_ps(
+        _mm_add_ps(_mm_mul_ps(dxs, dxs), _mm_mul_ps(dys, dys)));
+
+      fitnessSums = _mm_add_ps(fitnessSums, fitnesses);
+      minFitnesses = _mm_min_ps(minFitnesses, fitnesses);
+      maxFitnesses = _mm_max_ps(maxFitnesses, fitnesses);
+      xSums = _mm_add_ps(xSums, xs);
+      ySums = _mm_add_ps(ySums, ys);
+      minXs = _mm_min_ps(minXs, xs);
+      minYs = _mm_min_ps(minYs, ys);
+      maxXs = _mm_max_ps(maxXs, xs);
+      maxYs = _mm_max_ps(maxYs, ys);
+    }
+
+    totals.fitnessSum += _getLaneSum(fitnessSums);
+    totals.minFitness = _getLaneMin(minFitnesses);
+    totals.maxFitness = _getLaneMax(maxFitnesses);
+    totals.positionSum.x += _getLaneSum(xSums);
+    totals.positionSum.y += _getLaneSum(ySums);
+    totals.bounds.minPt.x = _getLaneMin(minXs);
+    totals.bounds.minPt.y = _getLaneMin(minYs);
+    totals.bounds.maxPt.x = _getLaneMax(maxXs);
+    totals.bounds.maxPt.y = _getLaneMax(maxYs);
+
+    return numBatchedWolves;
+  }
+
+  float _getMaxSquaredDistSSE2(const cx::Point* wolves,
+                               int32_t numBatchedWolves,
+                               cx::Point centre)
+  {
+    const __m128 centreXs = _mm_set1_ps(centre.x);
+    const __m128 centreYs = _mm_set1_ps(centre.y);
+    __m128 maxSquaredDists = _mm_setzero_ps();
+    for (int32_t i = 0; i < numBatchedWolves; i += 4) {
+      __m128 xs;
+      __m128 ys;
+      _loadPointsSSE2(wolves + i, xs, ys);
+
+      const __m128 dxs = _mm_sub_ps(xs, centreXs);
+      const __m128 dys = _mm_sub_ps(ys, centreYs);
+      maxSquaredDists = _mm_max_ps(
+        maxSquaredDists,
+        _mm_add_ps(_mm_mul_ps(dxs, dxs), _mm_mul_ps(dys, dys)));
+    }
+
+    return _getLaneMax(maxSquaredDists);
+  }
+#endif
+
+  // Combines the metrics field by field.
+  template <typename Combine>
+  GWOIterationMetrics _combineMetrics(const GWOIterationMetrics& a,
+                                      const GWOIterationMetrics& b,
+                                      Combine combine)
+  {
+    return GWOIterationMetrics{
+      combine(a.alphaFitness, b.alphaFitness),
+      combine(a.meanFitness, b.meanFitness),
+      combine(a.worstFitness, b.worstFitness),
+      cx::Point{ combine(a.packCentroid.x, b.packCentroid.x),
+                 combine(a.packCentroid.y, b.packCentroid.y) },
+      combine(a.packRadius, b.packRadius),
+      cx::AABB{
+        cx::Point{ combine(a.packBounds.minPt.x, b.packBounds.minPt.x),
+                   combine(a.packBounds.minPt.y, b.packBounds.minPt.y) },
+        cx::Point{ combine(a.packBounds.maxPt.x, b.packBounds.maxPt.x),
+                   combine(a.packBounds.maxPt.y, b.packBounds.maxPt.y) }
+      },
+      combine(a.preyDistance, b.preyDistance)
+    };
+  }
+  /////////////////////////////////////////////////
+
+  GWOMetrics::GWOMetrics()
+    : iterations()
+    , runningMinimums()
+    , runningMaximums()
+    , numIterations(0) {}
+
+  void GWOMetrics::reset(int32_t numIterations)
+  {
+    this->numIterations = 0;
+    this->iterations.resize(std::max(numIterations, 0));
+    this->runningMinimums.resize(this->iterations.size());
+    this->runningMaximums.resize(this->iterations.size());
+  }
+
+  void GWOMetrics::add(const cx::Point* wolves,
+                       int32_t numWolves,
+                       cx::Point bestSolution,
+                       cx::Point prey)
+  {
+    const int32_t iterIndex = this->numIterations.load(
+      std::memory_order_relaxed);
+    if (iterIndex >= static_cast<int32_t>(this->iterations.size())
+        || numWolves <= 0) {
+      return;
+    }
+
+    constexpr float kInfinity = std::numeric_limits<float>::infinity();
+    PackTotals totals{
+      0.f,
+      kInfinity,
+      -kInfinity,
+      cx::Point{ 0.f, 0.f },
+      cx::AABB{ cx::Point{ kInfinity, kInfinity },
+                cx::Point{ -kInfinity, -kInfinity } }
+    };
+
+    // The radius needs the centroid, so it takes a second pass.
+    int32_t numReducedWolves = 0;
+#ifdef GWOVIZ_GWO_METRICS_USE_SSE2
+    numReducedWolves = _addPackTotalsSSE2(wolves,
+                                          numWolves,
+                                          bestSolution,
+                                          totals);
+#endif
+    _addPackTotalsScalar(wolves + numReducedWolves,
+                         numWolves - numReducedWolves,
+                         bestSolution,
+                         totals);
+
+    const cx::Point centroid = totals.positionSum
+                               / static_cast<float>(numWolves);
+    float maxSquaredDist = 0.f;
+#ifdef GWOVIZ_GWO_METRICS_USE_SSE2
+    maxSquaredDist = _getMaxSquaredDistSSE2(wolves,
+                                            numReducedWolves,
+                                            centroid);
+#endif
+    maxSquaredDist = _getMaxSquaredDistScalar(wolves + numReducedWolves,
+                                              numWolves - numReducedWolves,
+                                              centroid,
+                                              maxSquaredDist);
+
+    const GWOIterationMetrics metrics{
+      totals.minFitness,
+      totals.fitnessSum / numWolves,
+      totals.maxFitness,
+      centroid,
+      std::sqrt(maxSquaredDist),
+      totals.bounds,
+      std::fabs(cx::distance2D(bestSolution, prey))
+    };
+    this->iterations[iterIndex] = metrics;
+
+    if (iterIndex == 0) {
+      this->runningMinimums[iterIndex] = metrics;
+      this->runningMaximums[iterIndex] = metrics;
+    } else {
+      this->runningMinimums[iterIndex] = _combineMetrics(
+        this->runningMinimums[iterIndex - 1],
+        metrics,
+        [](float a, float b) { return std::min(a, b); });
+      this->runningMaximums[iterIndex] = _combineMetrics(
+        this->runningMaximums[iterIndex - 1],
+        metrics,
+        [](float a, float b) { return std::max(a, b); });
+    }
+
+    // Only count the iteration once it's been written, so the UI never
+    // reads a half-written one.
+    this->numIterations.store(iterIndex + 1, std::memory_order_release);
+  }
+
+  int32_t GWOMetrics::size() const
+  {
+    return this->numIterations.load(std::memory_order_acquire);
+  }
+
+  const GWOIterationMetrics* GWOMetrics::data() const
+  {
+    return this->iterations.data();
+  }
+
+  int32_t GWOMetrics::getNumReservedIterations() const
+  {
+    return this->iterations.size();
+  }
+
+  const GWOIterationMetrics* GWOMetrics::getRunningMinimums() const
+  {
+    return this->runningMinimums.data();
+  }
+
+  const GWOIterationMetrics* GWOMetrics::getRunningMaximums() const
+  {
+    return this->runningMaximums.data();
+  }
+}
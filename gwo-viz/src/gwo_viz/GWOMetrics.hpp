@@ -0,0 +1,68 @@
+#ifndef GWOVIZ_GWO_METRICS_HPP
+#define GWOVIZ_GWO_METRICS_HPP
+
+#include <atomic>
+#include <cstdlib>
+
+#include <vector>
+
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+
+namespace gwo_viz
+{
+  // A summary of the pack at one iteration. A wolf's fitness is its distance
+  // to the best solution, so lower is better.
+  struct GWOIterationMetrics
+  {
+    float alphaFitness;
+    float meanFitness;
+    float worstFitness;
+    cx::Point packCentroid;
+    float packRadius; // Farthest distance of a wolf from the centroid.
+    cx::AABB packBounds;
+    float preyDistance; // Distance of the prey estimate to the best solution.
+  };
+
+  // The metrics of every iteration of a run, computed as the run goes. The
+  // GWO thread adds an iteration's metrics right after the iteration, using
+  // only that iteration's wolves, while the UI reads the iterations that are
+  // already in. Space for the whole run is reserved before it starts, so
+  // metrics never move once added, and an iteration only gets counted once
+  // its metrics have been written.
+  class GWOMetrics
+  {
+  public:
+    GWOMetrics();
+
+    // Must not be called while a run is adding metrics.
+    void reset(int32_t numIterations);
+
+    // Summarizes the wolves in two passes over them, with SSE2 when it's
+    // available. Ignored once every reserved iteration has been added.
+    void add(const cx::Point* wolves,
+             int32_t numWolves,
+             cx::Point bestSolution,
+             cx::Point prey);
+
+    // Safe to call while metrics are being added.
+    int32_t size() const;
+    const GWOIterationMetrics* data() const;
+    int32_t getNumReservedIterations() const;
+
+    // The i-th entry holds the smallest, or largest, value of each field over
+    // iterations 0 to i, so the range of a whole run so far can be read
+    // without going over every iteration. Safe to call while metrics are
+    // being added.
+    const GWOIterationMetrics* getRunningMinimums() const;
+    const GWOIterationMetrics* getRunningMaximums() const;
+
+  private:
+    std::vector<GWOIterationMetrics> iterations;
+    std::vector<GWOIterationMetrics> runningMinimums;
+    std::vector<GWOIterationMetrics> runningMaximums;
+    std::atomic<int32_t> numIterations;
+  };
+}
+
+#endif
@@ -3,15 +3,23 @@
 
 #include <cstdlib>
 
+#include <array>
 #include <vector>
 
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
 
 namespace gwo_viz {
-  using Solutions = std::vector<std::vector<cx::Point>>;
   struct GWOResult
   {
-    Solutions solutions;
+    // One frame per iteration, with the initial population as frame 0. A
+    // wolf keeps its index in every frame, so that it can be followed from
+    // one iteration to the next.
+    cx::PointHistory solutions;
+
+    // Indexes of the alpha, beta, and delta wolves, in that order, of each
+    // iteration.
+    std::vector<std::array<int32_t, 3>> leaderIndexes;
     std::vector<cx::Point> wolfPreys;
   };
 }
@@ -1,13 +1,21 @@
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <cstdio>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <utility>
 
+#include <EASTL/algorithm.h>
+#include <EASTL/string.h>
 #include <EASTL/vector.h>
 #include <entt/entt.hpp>
 #include <imgui.h>
@@ -17,6 +25,8 @@
 
 #include <corex/core/AssetManager.hpp>
 #include <corex/core/CameraZoomState.hpp>
+#include <corex/core/LaunchOptions.hpp>
+#include <corex/core/ReturnState.hpp>
 #include <corex/core/Scene.hpp>
 #include <corex/core/math_functions.hpp>
 #include <corex/core/utils.hpp>
@@ -25,20 +35,26 @@
 #include <corex/core/components/RenderableType.hpp>
 #include <corex/core/components/RenderCircle.hpp>
 #include <corex/core/components/RenderLineSegments.hpp>
+#include <corex/core/components/RenderPointCloud.hpp>
 #include <corex/core/components/RenderRectangle.hpp>
 #include <corex/core/components/RenderPolygon.hpp>
 #include <corex/core/components/Text.hpp>
+#include <corex/core/ds/AABB.hpp>
 #include <corex/core/ds/Circle.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/events/capture_events.hpp>
 #include <corex/core/events/KeyboardEvent.hpp>
 #include <corex/core/events/MouseButtonEvent.hpp>
 #include <corex/core/events/MouseMovementEvent.hpp>
 #include <corex/core/events/MouseScrollEvent.hpp>
 #include <corex/core/events/sys_events.hpp>
+#include <corex/core/renderer/DensityHeatmap.hpp>
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
 #include <corex/core/systems/KeyState.hpp>
 #include <corex/core/systems/MouseButtonState.hpp>
 #include <corex/core/systems/MouseButtonType.hpp>
 
+#include <gwo_viz/GWOMetrics.hpp>
 #include <gwo_viz/MainScene.hpp>
 
 namespace gwo_viz
@@ -53,14 +69,43 @@ namespace gwo_viz
     , ent_bestSol(entt::null)
     , numIterations(0)
     , numWolves(0)
+    , playbackPosition(0.f)
+    , playbackSpeed(10.f)
+    , isPlaying(false)
     , currIterDisplayed(0)
+    , interpolatedWolves()
     , gwo()
     , gwoResult()
-    , solutionEntities()
+    , pendingGWOResult()
+    , gwoMetrics()
+    , wolfEntityPool()
+    , wolfCloudEntity(entt::null)
     , preyEntity(entt::null)
     , isRunningGWO(false)
+    , minNumWolvesForHeatmap(10000)
+    , wolfHeatmap(
+        static_cast<int32_t>(std::ceil(this->regionWidth / kHeatmapCellSize)),
+        static_cast<int32_t>(std::ceil(this->regionHeight / kHeatmapCellSize)))
+    , heatmapEntity(entt::null)
+    , isHeatmapShown(false)
+    , trailedWolfIndexes()
+    , wolfTracks()
+    , trailEntityPool()
+    , areWolfTracksOutdated(true)
+    , areTrailsChanged(false)
+    , wolfPickTree(cx::AABB{
+        this->coordOrigin,
+        this->coordOrigin + cx::Point{ this->regionWidth, this->regionHeight }
+      })
+    , isWolfPickTreeOutdated(true)
+    , wasLeftMouseButtonDown(false)
     , isNewSolutionGenerated(false)
     , isIterDisplayedChanged(false)
+    , playbackCaptureFolder()
+    , playbackCaptureFormat(cx::FrameCaptureFormat::PNG)
+    , isPlaybackCaptureRequested(false)
+    , isCapturingPlayback(false)
+    , isLaunchCapturePending(false)
     , corex::core::Scene(registry, eventDispatcher, assetManager, camera) {}
 
   void MainScene::init()
@@ -69,6 +114,8 @@ namespace gwo_viz
 
     this->eventDispatcher.sink<corex::core::WindowEvent>()
       .connect<&MainScene::handleWindowEvents>(this);
+    this->eventDispatcher.sink<corex::core::MouseButtonEvent>()
+      .connect<&MainScene::handleMouseButtonEvents>(this);
 
     auto axesPoints = eastl::vector<cx::Point>{
       { coordOrigin.x, coordOrigin.y + regionHeight },
@@ -90,65 +137,87 @@ namespace gwo_viz
     this->ent_bestSol = this->createCircleEntity(newBestSolX, newBestSolY,
                                                  0.f, 5.f, true,
                                                  bestPositionColour, 1);
+
+    // The prey and the pack only get shown once there are solutions to take
+    // them from. The pack is drawn below the leaders, who are in it too.
+    SDL_Color preyColour{ 195, 73, 255, 255 };
+    this->preyEntity = this->createCircleEntity(0.f, 0.f, 2.f, 5.f, true,
+                                                preyColour, 1);
+    this->setEntityVisibility(this->preyEntity, false);
+
+    SDL_Color wolfColour{ 10, 41, 79, 255 };
+    this->wolfCloudEntity = this->createPointCloudEntity(
+      -0.5f, &this->gwoResult.solutions, 5.f, wolfColour, 1);
+    this->setEntityVisibility(this->wolfCloudEntity, false);
+
+    const cx::LaunchOptions& launchOptions = cx::getLaunchOptions();
+    if (!launchOptions.captureFolder.empty()) {
+      // Nobody is around to press the buttons, so generate a run ourselves
+      // and capture it once it's done.
+      this->numIterations = launchOptions.numCaptureIterations;
+      this->numWolves = launchOptions.numCaptureWolves;
+      this->isLaunchCapturePending = true;
+      this->generateSolutions();
+    }
   }
 
   void MainScene::update(float timeDelta)
   {
-    if (this->isNewSolutionGenerated) {
-      for (auto& entity : this->solutionEntities) {
-        this->registry.destroy(entity);
-      }
-
-      if (this->registry.valid(this->preyEntity)) {
-        this->registry.destroy(this->preyEntity);
-      }
+    // The GWO thread writes into a result of its own, so that the current
+    // solutions can still be drawn, and read straight from by the wolf point
+    // cloud, while a run is going on.
+    const bool isSolutionNew = this->isNewSolutionGenerated.exchange(false);
+    if (isSolutionNew) {
+      this->gwoResult = std::move(this->pendingGWOResult);
+
+      // Wolves that are in the new run keep their trails.
+      const int32_t numWolves = this->gwoResult.solutions.getNumPoints();
+      this->trailedWolfIndexes.erase(
+        eastl::remove_if(this->trailedWolfIndexes.begin(),
+                         this->trailedWolfIndexes.end(),
+                         [numWolves](int32_t wolfIndex) {
+                           return wolfIndex >= numWolves;
+                         }),
+        this->trailedWolfIndexes.end());
+      this->areWolfTracksOutdated = true;
+      this->areTrailsChanged = true;
+    }
 
-      this->solutionEntities.clear();
-
-      SDL_Color solutionColour;
-      auto& currIteration = this->gwoResult.solutions[this->currIterDisplayed];
-      for (int32_t i = 0; i < currIteration.size(); i++) {
-        if (i == 0) {
-          // Entity for the alpha wolf.
-          solutionColour = SDL_Color{ 79, 10, 22, 255 };
-        } else if (i == 1) {
-          // Entity for the beta wolf.
-          solutionColour = SDL_Color{ 82, 43, 15, 255 };
-        } else if (i == 2) {
-          // Entity for the delta wolf.
-          solutionColour = SDL_Color{ 82, 78, 15, 255 };
-        } else {
-          solutionColour = SDL_Color{ 10, 41, 79, 255 };
-        }
+    // Switch between the heatmap and the point cloud as the camera zooms.
+    const bool isDrawModeOutdated = !this->gwoResult.solutions.empty()
+                                    && (this->shouldShowHeatmap()
+                                        != this->isHeatmapShown);
+    if (isSolutionNew || isDrawModeOutdated) {
+      this->showWolfEntities(this->shouldShowHeatmap());
+    }
 
-        this->solutionEntities.push_back(
-          this->createCircleEntity(currIteration[i].x, currIteration[i].y,
-                                   0.f, 5.f, true, solutionColour, 1)
-        );
-      }
+    if (this->isLaunchCapturePending && isSolutionNew) {
+      const cx::LaunchOptions& launchOptions = cx::getLaunchOptions();
+      this->requestPlaybackCapture(launchOptions.captureFolder,
+                                   launchOptions.captureFormat);
+      this->isLaunchCapturePending = false;
+    }
 
-      SDL_Color preyColour{ 195, 73, 255, 255 };
-      this->preyEntity = this->createCircleEntity(
-        this->gwoResult.wolfPreys[this->currIterDisplayed].x,
-        this->gwoResult.wolfPreys[this->currIterDisplayed].y,
-        2.f, 5.f, true, preyColour, 1);
+    // This has to happen before the wolf positions get updated, so that the
+    // captured frame shows the iteration we stepped to.
+    if (this->isPlaybackCaptureRequested) {
+      this->startPlaybackCapture();
+    } else if (this->isCapturingPlayback) {
+      this->advancePlaybackCapture();
+    } else if (this->isPlaying) {
+      this->advancePlayback(timeDelta);
     }
 
     if (this->isIterDisplayedChanged) {
-      for (int32_t i = 0; i < this->solutionEntities.size(); i++) {
-        auto& wolfPos = this->getEntityComponent<cx::Position>(
-          solutionEntities[i]);
-        wolfPos.x = this->gwoResult.solutions[this->currIterDisplayed][i].x;
-        wolfPos.y = this->gwoResult.solutions[this->currIterDisplayed][i].y;
-      }
-
-      auto& preyPos = this->getEntityComponent<cx::Position>(this->preyEntity);
-      preyPos.x = this->gwoResult.wolfPreys[this->currIterDisplayed].x;
-      preyPos.y = this->gwoResult.wolfPreys[this->currIterDisplayed].y;
-
+      this->updateWolfEntities();
       this->isIterDisplayedChanged = false;
     }
 
+    if (this->areTrailsChanged) {
+      this->updateWolfTrails();
+      this->areTrailsChanged = false;
+    }
+
     this->flashBestSolPosition(timeDelta);
 
     this->buildControls();
@@ -186,6 +255,323 @@ namespace gwo_viz
     }
   }
 
+  void MainScene::generateSolutions()
+  {
+    this->numIterations = std::max(this->numIterations, 0);
+    this->numWolves = std::max(this->numWolves, 0);
+
+    // The initial population gets metrics too.
+    this->gwoMetrics.reset(this->numIterations + 1);
+
+    this->isRunningGWO = true;
+    std::thread gwoThread{
+      [this](int32_t numIterations,
+             int32_t numWolves,
+             cx::Point bestSolution,
+             cx::Point minPt,
+             cx::Point maxPt) {
+        this->pendingGWOResult = this->gwo.optimize(numIterations,
+                                                    numWolves,
+                                                    bestSolution,
+                                                    minPt,
+                                                    maxPt,
+                                                    &this->gwoMetrics);
+        // Flagged as ready before the run is flagged as done, so that no new
+        // run can be started before this result has been taken.
+        this->isNewSolutionGenerated = true;
+        this->isRunningGWO = false;
+      },
+      this->numIterations,
+      this->numWolves,
+      this->bestSol,
+      this->coordOrigin,
+      this->coordOrigin + cx::Point{ this->regionWidth, this->regionHeight }
+    };
+
+    gwoThread.detach();
+  }
+
+  bool MainScene::shouldShowHeatmap()
+  {
+    if (this->gwoResult.solutions.empty()) {
+      return false;
+    }
+
+    const int32_t numWolves = this->gwoResult.solutions.getNumPoints();
+    return numWolves >= this->minNumWolvesForHeatmap
+           && this->camera.getZoomX() < kMaxHeatmapZoom;
+  }
+
+  void MainScene::showWolfEntities(bool isHeatmapUsed)
+  {
+    // The solutions might have fewer iterations than what was displayed.
+    this->setPlaybackPosition(this->playbackPosition);
+
+    const cx::PointHistory& solutions = this->gwoResult.solutions;
+    if (this->interpolatedWolves.getNumPoints() != solutions.getNumPoints()) {
+      this->interpolatedWolves = cx::PointHistory{ solutions.getNumPoints(),
+                                                   1 };
+      this->interpolatedWolves.addFrame(solutions.getFrame(0));
+    }
+
+    // Leader entities are kept around between runs, and only get hidden when
+    // there are fewer than three wolves.
+    const int32_t numLeaders = std::min(solutions.getNumPoints(), 3);
+    this->resizeEntityPool(this->wolfEntityPool, numLeaders, [this]() {
+      // Alpha, beta, and delta wolf, in that order.
+      const SDL_Color leaderColours[3] = {
+        SDL_Color{ 79, 10, 22, 255 },
+        SDL_Color{ 82, 43, 15, 255 },
+        SDL_Color{ 82, 78, 15, 255 }
+      };
+      const int32_t wolfIndex = this->wolfEntityPool.entities.size();
+      return this->createCircleEntity(0.f, 0.f, 0.f, 5.f, true,
+                                      leaderColours[wolfIndex], 1);
+    });
+    this->setEntityVisibility(this->wolfCloudEntity, !isHeatmapUsed);
+    this->setEntityVisibility(this->preyEntity, true);
+
+    // Also updates the heatmap's texture if it's shown.
+    this->isHeatmapShown = isHeatmapUsed;
+    this->updateWolfEntities();
+    this->isIterDisplayedChanged = false;
+
+    if (this->heatmapEntity == entt::null) {
+      if (isHeatmapUsed) {
+        // The heatmap's texture only exists once it has been updated.
+        const cx::Point regionCentre = this->coordOrigin
+                                       + cx::Point{ this->regionWidth / 2.f,
+                                                    this->regionHeight / 2.f };
+        this->heatmapEntity = this->createImageEntity(
+          regionCentre.x, regionCentre.y, -1.f,
+          this->regionWidth, this->regionHeight,
+          this->wolfHeatmap.getTexture(), 1);
+      }
+    } else {
+      this->setEntityVisibility(this->heatmapEntity, isHeatmapUsed);
+    }
+  }
+
+  void MainScene::updateWolfEntities()
+  {
+    const cx::PointHistory& solutions = this->gwoResult.solutions;
+    if (solutions.empty()) {
+      return;
+    }
+
+    const int32_t fromIter = this->currIterDisplayed;
+    const int32_t toIter = std::min(fromIter + 1, solutions.getNumFrames() - 1);
+    const float t = this->playbackPosition - fromIter;
+
+    // Right on an iteration, the pack is read straight from the solutions.
+    // In between iterations, it gets interpolated into a frame of its own.
+    auto& wolfCloud = this->getEntityComponent<cx::RenderPointCloud>(
+      this->wolfCloudEntity);
+    const cx::Point* wolves = solutions.getFrame(fromIter);
+    if (t > 0.f && toIter != fromIter) {
+      cx::Point* interpolatedFrame = this->interpolatedWolves.getFrame(0);
+      solutions.interpolate(this->playbackPosition, interpolatedFrame);
+      wolves = interpolatedFrame;
+
+      wolfCloud.history = &this->interpolatedWolves;
+      wolfCloud.frameIndex = 0;
+    } else {
+      wolfCloud.history = &solutions;
+      wolfCloud.frameIndex = fromIter;
+    }
+
+    // Wolves keep their indexes across iterations, so the leaders of the
+    // iteration we're coming from can be followed to the next one.
+    const auto& leaderIndexes = this->gwoResult.leaderIndexes[fromIter];
+    for (int32_t i = 0; i < this->wolfEntityPool.numActiveEntities; i++) {
+      auto& wolfPos = this->getEntityComponent<cx::Position>(
+        this->wolfEntityPool.entities[i]);
+      wolfPos.x = wolves[leaderIndexes[i]].x;
+      wolfPos.y = wolves[leaderIndexes[i]].y;
+    }
+
+    if (this->isHeatmapShown) {
+      this->updateWolfHeatmap(wolves);
+    }
+
+    this->isWolfPickTreeOutdated = true;
+
+    const cx::Point& fromPrey = this->gwoResult.wolfPreys[fromIter];
+    const cx::Point& toPrey = this->gwoResult.wolfPreys[toIter];
+    auto& preyPos = this->getEntityComponent<cx::Position>(this->preyEntity);
+    preyPos.x = fromPrey.x + ((toPrey.x - fromPrey.x) * t);
+    preyPos.y = fromPrey.y + ((toPrey.y - fromPrey.y) * t);
+  }
+
+  void MainScene::updateWolfHeatmap(const cx::Point* wolves)
+  {
+    const cx::AABB regionBounds{
+      this->coordOrigin,
+      this->coordOrigin + cx::Point{ this->regionWidth, this->regionHeight }
+    };
+    this->wolfHeatmap.bin(wolves,
+                          this->gwoResult.solutions.getNumPoints(),
+                          regionBounds);
+    this->wolfHeatmap.updateTexture();
+  }
+
+  void MainScene::updateWolfTrails()
+  {
+    const int32_t numTrails = this->gwoResult.solutions.empty()
+                              ? 0
+                              : this->trailedWolfIndexes.size();
+    if (numTrails > 0 && this->areWolfTracksOutdated) {
+      // Gathering a wolf's track from the solutions would mean a strided
+      // read through every iteration, so the tracks are transposed once.
+      this->wolfTracks = this->gwoResult.solutions.transpose();
+      this->areWolfTracksOutdated = false;
+    }
+
+    // Trails share a colour and z so that they get drawn as a single batch
+    // of lines, below the leaders and above the rest of the pack.
+    const SDL_Color trailColour{ 236, 236, 236, 255 };
+    this->resizeEntityPool(
+      this->trailEntityPool,
+      numTrails,
+      [this, &trailColour]() {
+        return this->createLineSegmentsEntity(-0.25f, {}, trailColour, 1);
+      });
+
+    for (int32_t i = 0; i < numTrails; i++) {
+      // Replacing the component is what gets the line batches rebuilt.
+      const cx::Point* track = this->wolfTracks.getFrame(
+        this->trailedWolfIndexes[i]);
+      this->setEntityComponent<cx::RenderLineSegments>(
+        this->trailEntityPool.entities[i],
+        eastl::vector<cx::Point>(track,
+                                 track + this->wolfTracks.getNumPoints()),
+        trailColour);
+    }
+  }
+
+  bool MainScene::isWolfTrailed(int32_t wolfIndex)
+  {
+    return eastl::find(this->trailedWolfIndexes.begin(),
+                       this->trailedWolfIndexes.end(),
+                       wolfIndex) != this->trailedWolfIndexes.end();
+  }
+
+  void MainScene::toggleWolfTrail(int32_t wolfIndex)
+  {
+    auto wolfIndexIter = eastl::find(this->trailedWolfIndexes.begin(),
+                                     this->trailedWolfIndexes.end(),
+                                     wolfIndex);
+    if (wolfIndexIter == this->trailedWolfIndexes.end()) {
+      this->trailedWolfIndexes.push_back(wolfIndex);
+    } else {
+      this->trailedWolfIndexes.erase(wolfIndexIter);
+    }
+
+    this->areTrailsChanged = true;
+  }
+
+  void MainScene::pickWolf(const cx::Point& screenPt)
+  {
+    SDL_Window* window = SDL_GetMouseFocus();
+    if (this->gwoResult.solutions.empty()
+        || window == nullptr
+        || this->camera.getZoomX() == 0.f
+        || this->camera.getZoomY() == 0.f) {
+      return;
+    }
+
+    int32_t windowWidth = 0;
+    int32_t windowHeight = 0;
+    SDL_GetWindowSize(window, &windowWidth, &windowHeight);
+    const cx::Point worldPt = this->camera.screenToWorld(screenPt,
+                                                         windowWidth,
+                                                         windowHeight);
+
+    const auto& wolfCloud = this->getEntityComponent<cx::RenderPointCloud>(
+      this->wolfCloudEntity);
+    if (this->isWolfPickTreeOutdated) {
+      const cx::Point* wolves = wolfCloud.history->getFrame(
+        wolfCloud.frameIndex);
+      this->wolfPickTree.clear();
+      for (int32_t i = 0; i < wolfCloud.history->getNumPoints(); i++) {
+        this->wolfPickTree.insert(i, wolves[i]);
+      }
+
+      this->isWolfPickTreeOutdated = false;
+    }
+
+    auto pickedWolf = this->wolfPickTree.queryNearest(worldPt,
+                                                      wolfCloud.radius);
+    if (pickedWolf.status == corex::core::ReturnState::RETURN_OK) {
+      this->toggleWolfTrail(pickedWolf.value);
+    }
+  }
+
+  void MainScene::setPlaybackPosition(float position)
+  {
+    const int32_t numIters = this->gwoResult.solutions.getNumFrames();
+    const float lastIter = static_cast<float>(std::max(numIters - 1, 0));
+    this->playbackPosition = cx::clamp(position, 0.f, lastIter);
+    this->currIterDisplayed = static_cast<int32_t>(this->playbackPosition);
+    this->isIterDisplayedChanged = true;
+  }
+
+  void MainScene::advancePlayback(float timeDelta)
+  {
+    // Stops at the last iteration, instead of wrapping around, so that the
+    // final state of the pack stays on screen.
+    const float lastIter = static_cast<float>(
+      std::max(this->gwoResult.solutions.getNumFrames() - 1, 0));
+    const float position = this->playbackPosition
+                           + (this->playbackSpeed * timeDelta);
+    if (position >= lastIter) {
+      this->isPlaying = false;
+    }
+
+    this->setPlaybackPosition(position);
+  }
+
+  void MainScene::requestPlaybackCapture(const eastl::string& outputFolder,
+                                         cx::FrameCaptureFormat format)
+  {
+    // The capture only starts in the next update, once the first iteration
+    // is in place.
+    this->playbackCaptureFolder = outputFolder;
+    this->playbackCaptureFormat = format;
+    this->isPlaybackCaptureRequested = true;
+  }
+
+  void MainScene::startPlaybackCapture()
+  {
+    this->isPlaying = false;
+    this->setPlaybackPosition(0.f);
+    this->isPlaybackCaptureRequested = false;
+    this->isCapturingPlayback = true;
+
+    // Triggered, not enqueued, so that this frame gets captured too.
+    this->eventDispatcher.trigger<cx::FrameCaptureStartEvent>(
+      this->playbackCaptureFolder,
+      this->playbackCaptureFormat);
+  }
+
+  void MainScene::advancePlaybackCapture()
+  {
+    // The user might have changed the number of iterations after generating
+    // the solutions, so we go by what we actually have.
+    const int32_t lastIter = this->gwoResult.solutions.getNumFrames() - 1;
+    if (this->currIterDisplayed < lastIter) {
+      this->setPlaybackPosition(this->currIterDisplayed + 1);
+      return;
+    }
+
+    this->eventDispatcher.trigger<cx::FrameCaptureStopEvent>();
+    this->isCapturingPlayback = false;
+
+    if (!cx::getLaunchOptions().captureFolder.empty()) {
+      this->setSceneStatus(corex::core::SceneStatus::DONE);
+    }
+  }
+
   void MainScene::buildControls()
   {
     ImGui::Begin("Controls");
@@ -207,87 +593,121 @@ namespace gwo_viz
 
     ImGui::Separator();
 
-    if (ImGui::InputInt("No. of Iterations", &this->numIterations)) {
-      // We are not subtracting numIterations by 1 in consideration of the
-      // initial random population.
-      this->currIterDisplayed = cx::clamp(this->currIterDisplayed,
-                                          0, this->numIterations);
-    }
+    ImGui::InputInt("No. of Iterations", &this->numIterations);
 
     ImGui::InputInt("No. of Wolves", &this->numWolves);
+    ImGui::InputInt("Heatmap Threshold", &this->minNumWolvesForHeatmap);
+    ImGui::Text("Wolves are drawn as %s.",
+                this->isHeatmapShown ? "a density heatmap" : "circles");
 
-    if (this->isRunningGWO) {
+    if (this->isRunningGWO || this->isNewSolutionGenerated) {
       ImGui::Text("Iteration #%d of %d",
                   this->gwo.getNumItersPerformed(),
                   this->numIterations);
     } else {
       if (ImGui::Button("Generate Solutions")) {
-        this->isRunningGWO = true;
-        std::thread gwoThread{
-          [this](int32_t numIterations,
-                 int32_t numWolves,
-                 cx::Point bestSolution,
-                 cx::Point minPt,
-                 cx::Point maxPt) {
-            this->gwoResult = this->gwo.optimize(numIterations,
-                                                 numWolves,
-                                                 bestSolution,
-                                                 minPt,
-                                                 maxPt);
-            this->isRunningGWO = false;
-            this->isNewSolutionGenerated = true;
-          },
-          this->numIterations,
-          this->numWolves,
-          this->bestSol,
-          this->coordOrigin,
-          this->coordOrigin + cx::Point{ this->regionWidth, this->regionHeight }
-        };
-
-        gwoThread.detach();
+        this->generateSolutions();
       }
     }
 
     ImGui::Separator();
 
-    ImGui::Text("Iteration Displayed");
-
-    if (ImGui::Button("<")) {
-      if (this->numIterations > 0) {
-        // Only change the current iteration displayed if we have set a non-zero
-        // number of iterations.
-        //
-        // We are increasing numIterations by 1 in consideration of the
-        // initial random population.
-        this->currIterDisplayed = cx::mod(this->currIterDisplayed - 1,
-                                          this->numIterations + 1);
-        this->isIterDisplayedChanged = true;
+    ImGui::Text("Playback");
+
+    // Iterations go from 0 to the number of iterations, since the initial
+    // random population counts as an iteration.
+    const int32_t lastIter = std::max(
+      this->gwoResult.solutions.getNumFrames() - 1, 0);
+    if (this->gwoResult.solutions.empty() || this->isCapturingPlayback) {
+      ImGui::Text("Iteration %d", this->currIterDisplayed);
+    } else {
+      if (ImGui::Button(this->isPlaying ? "Pause" : "Play")) {
+        // Playing from the last iteration starts over.
+        if (!this->isPlaying && this->playbackPosition >= lastIter) {
+          this->setPlaybackPosition(0.f);
+        }
+
+        this->isPlaying = !this->isPlaying;
+      }
+
+      ImGui::SameLine();
+
+      if (ImGui::Button("<")) {
+        this->isPlaying = false;
+        this->setPlaybackPosition(
+          static_cast<float>(cx::mod(this->currIterDisplayed - 1,
+                                     lastIter + 1)));
+      }
+
+      ImGui::SameLine();
+
+      if (ImGui::Button(">")) {
+        this->isPlaying = false;
+        this->setPlaybackPosition(
+          static_cast<float>(cx::mod(this->currIterDisplayed + 1,
+                                     lastIter + 1)));
       }
+
+      float scrubberPosition = this->playbackPosition;
+      if (ImGui::SliderFloat("Iteration",
+                             &scrubberPosition,
+                             0.f,
+                             static_cast<float>(lastIter),
+                             "%.2f")) {
+        this->setPlaybackPosition(scrubberPosition);
+      }
+
+      ImGui::SliderFloat("Speed (iterations/s)",
+                         &this->playbackSpeed,
+                         0.5f,
+                         60.f,
+                         "%.1f");
     }
 
-    ImGui::SameLine();
+    ImGui::Separator();
 
-    if (ImGui::InputInt("", &this->currIterDisplayed)) {
-      // We are not subtracting numIterations by 1 in consideration of the
-      // initial random population.
-      this->currIterDisplayed = cx::clamp(this->currIterDisplayed,
-                                          0, this->numIterations);
+    if (ImGui::CollapsingHeader("Convergence")) {
+      this->buildMetricsPlots();
     }
 
-    ImGui::SameLine();
+    ImGui::Separator();
+
+    ImGui::Text("Export Frames");
 
-    if (ImGui::Button(">")) {
-      if (this->numIterations > 0) {
-        // Only change the current iteration displayed if we have set a non-zero
-        // number of iterations.
-        //
-        // We are increasing numIterations by 1 in consideration of the
-        // initial random population.
-        this->currIterDisplayed = cx::mod(this->currIterDisplayed + 1,
-                                          this->numIterations + 1);
-        this->isIterDisplayedChanged = true;
+    if (this->isCapturingPlayback || this->isPlaybackCaptureRequested) {
+      ImGui::Text("Capturing iteration %d of %d",
+                  this->currIterDisplayed,
+                  this->gwoResult.solutions.getNumFrames() - 1);
+    } else if (this->gwoResult.solutions.empty() || this->isRunningGWO) {
+      ImGui::Text("Generate solutions first.");
+    } else {
+      bool isExportRequested = false;
+      cx::FrameCaptureFormat exportFormat = cx::FrameCaptureFormat::PNG;
+      if (ImGui::Button("Export as PNG")) {
+        isExportRequested = true;
+        exportFormat = cx::FrameCaptureFormat::PNG;
       }
-    };
+
+      ImGui::SameLine();
+
+      if (ImGui::Button("Export as Raw")) {
+        isExportRequested = true;
+        exportFormat = cx::FrameCaptureFormat::RAW;
+      }
+
+      if (isExportRequested) {
+        // Each export goes into its own timestamped folder.
+        const std::time_t currTime = std::time(nullptr);
+        std::stringstream folderName;
+        folderName << std::put_time(std::localtime(&currTime),
+                                    "%Y%m%d-%H%M%S");
+        const std::filesystem::path captureFolder = cx::getBinFolder()
+                                                    / "captures"
+                                                    / folderName.str();
+        this->requestPlaybackCapture(cx::stdStrToEAStr(captureFolder.string()),
+                                     exportFormat);
+      }
+    }
 
     ImGui::Separator();
 
@@ -297,10 +717,12 @@ namespace gwo_viz
     ImGui::Text("- Red circle is the alpha wolf.");
     ImGui::Text("- Orange circle is the beta wolf.");
     ImGui::Text("- Yellow circle is the alpha wolf.");
+    ImGui::Text("- Heatmap goes from blue to yellow as the pack gets denser.");
+    ImGui::Text("- White lines are the trails of the selected wolves.");
 
     ImGui::Separator();
 
-    if (this->registry.valid(this->preyEntity)) {
+    if (this->isEntityVisible(this->preyEntity)) {
       auto& preyPos = this->getEntityComponent<cx::Position>(this->preyEntity);
       ImGui::Text("Prey Location: (%f, %f)", preyPos.x, preyPos.y);
     }
@@ -308,14 +730,46 @@ namespace gwo_viz
     ImGui::Separator();
 
     ImGui::Text("Solution Values");
+    ImGui::Text("Click on a wolf to show or hide its trail.");
+
+    if (!this->gwoResult.solutions.empty()) {
+      if (ImGui::Button("Trail Leaders")) {
+        for (int32_t wolfIndex
+               : this->gwoResult.leaderIndexes[this->currIterDisplayed]) {
+          if (!this->isWolfTrailed(wolfIndex)) {
+            this->toggleWolfTrail(wolfIndex);
+          }
+        }
+      }
 
-    ImGui::BeginChild("solutionVals");
+      ImGui::SameLine();
+
+      if (ImGui::Button("Clear Trails")) {
+        this->trailedWolfIndexes.clear();
+        this->areTrailsChanged = true;
+      }
+    }
 
-    for (int32_t i = 0; i < this->solutionEntities.size(); i++) {
-      const auto& wolf = this->gwoResult.solutions[this->currIterDisplayed][i];
-      float dist = std::fabs(cx::distance2D(bestSol, wolf));
+    ImGui::BeginChild("solutionVals");
 
-      ImGui::Text("%d: (%f, %f) Dist: %f", i, wolf.x, wolf.y, dist);
+    if (this->currIterDisplayed < this->gwoResult.solutions.getNumFrames()) {
+      // Only the rows in view get built, since there can be a lot of wolves.
+      const cx::Point* currIteration = this->gwoResult.solutions.getFrame(
+        this->currIterDisplayed);
+      ImGuiListClipper clipper(this->gwoResult.solutions.getNumPoints());
+      while (clipper.Step()) {
+        for (int32_t i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+          const auto& wolf = currIteration[i];
+          float dist = std::fabs(cx::distance2D(bestSol, wolf));
+
+          char wolfLabel[128];
+          std::snprintf(wolfLabel, sizeof(wolfLabel),
+                        "%d: (%f, %f) Dist: %f", i, wolf.x, wolf.y, dist);
+          if (ImGui::Selectable(wolfLabel, this->isWolfTrailed(i))) {
+            this->toggleWolfTrail(i);
+          }
+        }
+      }
     }
 
     ImGui::EndChild();
@@ -323,10 +777,123 @@ namespace gwo_viz
     ImGui::End();
   }
 
+  void MainScene::buildMetricsPlots()
+  {
+    const int32_t numMetrics = this->gwoMetrics.size();
+    if (numMetrics == 0) {
+      ImGui::Text("Generate solutions first.");
+      return;
+    }
+
+    struct MetricSeries
+    {
+      const char* label;
+      size_t offset; // Offset of the metric in GWOIterationMetrics.
+    };
+
+    // The metrics are plotted straight from the array of structs, using the
+    // struct's size as the stride. The x axis spans the whole run, so that
+    // the plots fill in as the run goes.
+    const GWOIterationMetrics* metrics = this->gwoMetrics.data();
+    const int32_t stride = sizeof(GWOIterationMetrics);
+    const double lastIter = std::max(
+      this->gwoMetrics.getNumReservedIterations() - 1, 1);
+
+    // The extremes of the iterations so far are kept up by the metrics, so
+    // the y axis limits don't need a pass over every iteration.
+    const GWOIterationMetrics& minimums =
+      this->gwoMetrics.getRunningMinimums()[numMetrics - 1];
+    const GWOIterationMetrics& maximums =
+      this->gwoMetrics.getRunningMaximums()[numMetrics - 1];
+    auto getValues = [](const GWOIterationMetrics* iterations,
+                        size_t offset) {
+      return reinterpret_cast<const float*>(
+        reinterpret_cast<const char*>(iterations) + offset);
+    };
+    auto plotMetrics = [&](const char* title,
+                           const MetricSeries* series,
+                           int32_t numSeries) {
+      float minValue = std::numeric_limits<float>::max();
+      float maxValue = std::numeric_limits<float>::lowest();
+      for (int32_t i = 0; i < numSeries; i++) {
+        minValue = std::min(minValue,
+                            *getValues(&minimums, series[i].offset));
+        maxValue = std::max(maxValue,
+                            *getValues(&maximums, series[i].offset));
+      }
+
+      // Leave some room so that flat lines don't sit on the plot's edges.
+      const float margin = std::max((maxValue - minValue) * 0.05f, 1.f);
+      ImPlot::SetNextPlotLimits(0.0, lastIter,
+                                minValue - margin, maxValue + margin,
+                                ImGuiCond_Always);
+      if (ImPlot::BeginPlot(title, "Iteration", nullptr, ImVec2(-1, 150))) {
+        for (int32_t i = 0; i < numSeries; i++) {
+          ImPlot::PlotLine(series[i].label,
+                           getValues(metrics, series[i].offset),
+                           numMetrics,
+                           0,
+                           stride);
+        }
+
+        ImPlot::EndPlot();
+      }
+    };
+
+    const MetricSeries fitnessSeries[] = {
+      { "Alpha", offsetof(GWOIterationMetrics, alphaFitness) },
+      { "Mean", offsetof(GWOIterationMetrics, meanFitness) },
+      { "Worst", offsetof(GWOIterationMetrics, worstFitness) }
+    };
+    plotMetrics("Fitness (Distance to Best)", fitnessSeries, 3);
+
+    const MetricSeries spreadSeries[] = {
+      { "Pack Radius", offsetof(GWOIterationMetrics, packRadius) },
+      { "Prey Distance", offsetof(GWOIterationMetrics, preyDistance) }
+    };
+    plotMetrics("Pack Spread", spreadSeries, 2);
+
+    const MetricSeries positionSeries[] = {
+      { "Centroid X", offsetof(GWOIterationMetrics, packCentroid.x) },
+      { "Centroid Y", offsetof(GWOIterationMetrics, packCentroid.y) },
+      { "Min X", offsetof(GWOIterationMetrics, packBounds.minPt.x) },
+      { "Max X", offsetof(GWOIterationMetrics, packBounds.maxPt.x) },
+      { "Min Y", offsetof(GWOIterationMetrics, packBounds.minPt.y) },
+      { "Max Y", offsetof(GWOIterationMetrics, packBounds.maxPt.y) }
+    };
+    plotMetrics("Pack Position", positionSeries, 6);
+
+    const GWOIterationMetrics& latestMetrics = metrics[numMetrics - 1];
+    ImGui::Text("Iteration %d: Alpha %.3f, Mean %.3f, Radius %.3f",
+                numMetrics - 1,
+                latestMetrics.alphaFitness,
+                latestMetrics.meanFitness,
+                latestMetrics.packRadius);
+  }
+
   void MainScene::handleWindowEvents(const corex::core::WindowEvent& e)
   {
     if (e.event.window.event == SDL_WINDOWEVENT_CLOSE) {
       this->setSceneStatus(corex::core::SceneStatus::DONE);
     }
   }
+
+  void MainScene::handleMouseButtonEvents(
+    const corex::core::MouseButtonEvent& e)
+  {
+    if (e.buttonType != corex::core::MouseButtonType::MOUSE_BUTTON_LEFT) {
+      return;
+    }
+
+    // The state of the button gets sent every frame, so a click is when it
+    // goes down. Clicks on the controls never reach us.
+    const bool isLeftMouseButtonDown = e.buttonState
+      == corex::core::MouseButtonState::MOUSE_BUTTON_DOWN;
+    if (isLeftMouseButtonDown && !this->wasLeftMouseButtonDown) {
+      this->pickWolf(cx::Point{ static_cast<float>(e.x),
+                                static_cast<float>(e.y) });
+    }
+
+    this->wasLeftMouseButtonDown = isLeftMouseButtonDown;
+  }
 }
@@ -3,6 +3,7 @@
 
 #include <atomic>
 
+#include <EASTL/string.h>
 #include <EASTL/vector.h>
 #include <entt/entt.hpp>
 #include <nlohmann/json.hpp>
@@ -15,14 +16,19 @@
 #include <corex/core/ds/LineSegments.hpp>
 #include <corex/core/ds/NPolygon.hpp>
 #include <corex/core/ds/Point.hpp>
+#include <corex/core/ds/PointHistory.hpp>
 #include <corex/core/ds/Polygon.hpp>
+#include <corex/core/ds/QuadTree.hpp>
 #include <corex/core/events/KeyboardEvent.hpp>
 #include <corex/core/events/MouseButtonEvent.hpp>
 #include <corex/core/events/MouseMovementEvent.hpp>
 #include <corex/core/events/MouseScrollEvent.hpp>
 #include <corex/core/events/sys_events.hpp>
+#include <corex/core/renderer/DensityHeatmap.hpp>
+#include <corex/core/renderer/FrameCaptureFormat.hpp>
 
 #include <gwo_viz/GWO.hpp>
+#include <gwo_viz/GWOMetrics.hpp>
 #include <gwo_viz/GWOResult.hpp>
 
 namespace gwo_viz
@@ -40,6 +46,13 @@ namespace gwo_viz
     void dispose() override;
 
   private:
+    // Size of a heatmap cell in world units.
+    static constexpr float kHeatmapCellSize = 3.f;
+
+    // The heatmap gets swapped for circles once the camera is zoomed in this
+    // much, since there are few enough wolves in view to draw each of them.
+    static constexpr float kMaxHeatmapZoom = 2.f;
+
     float regionWidth;
     float regionHeight;
     cx::Point coordOrigin;
@@ -49,22 +62,87 @@ namespace gwo_viz
     int32_t numIterations;
     int32_t numWolves;
 
+    // Playback moves through the iterations at playbackSpeed iterations per
+    // second. The position is fractional, and wolves get interpolated between
+    // the iterations around it. currIterDisplayed is the iteration right
+    // before the position.
+    float playbackPosition;
+    float playbackSpeed;
+    bool isPlaying;
     int32_t currIterDisplayed;
+    cx::PointHistory interpolatedWolves; // A single frame.
 
     GWO gwo;
     GWOResult gwoResult;
-    std::vector<Scene::Entity> solutionEntities;
+    GWOResult pendingGWOResult; // Written by the GWO thread.
+
+    // Metrics of the latest run, which fill in while the run is going on.
+    GWOMetrics gwoMetrics;
+
+    // The whole pack is a point cloud that reads its positions straight from
+    // the solutions. The alpha, beta, and delta wolves also get circles of
+    // their own, so that they can be seen on top of the rest of the pack.
+    Scene::EntityPool wolfEntityPool;
+    Scene::Entity wolfCloudEntity;
     Scene::Entity preyEntity;
-    bool isRunningGWO;
+    std::atomic<bool> isRunningGWO;
 
-    bool isNewSolutionGenerated;
+    // Packs with at least this many wolves are drawn as a density heatmap
+    // instead of a point cloud.
+    int32_t minNumWolvesForHeatmap;
+    cx::DensityHeatmap wolfHeatmap;
+    Scene::Entity heatmapEntity;
+    bool isHeatmapShown;
+
+    // Trails show the paths of the selected wolves through every iteration.
+    // They are read from a wolf-major copy of the solutions, which only gets
+    // built once a trail is needed.
+    eastl::vector<int32_t> trailedWolfIndexes;
+    cx::PointHistory wolfTracks;
+    Scene::EntityPool trailEntityPool;
+    bool areWolfTracksOutdated;
+    bool areTrailsChanged;
+
+    // Clicking on a wolf toggles its trail. The displayed wolves are put in a
+    // quadtree to find the clicked one, which only gets rebuilt on a click
+    // after the wolves have moved.
+    cx::QuadTree<int32_t> wolfPickTree;
+    bool isWolfPickTreeOutdated;
+    bool wasLeftMouseButtonDown;
+
+    std::atomic<bool> isNewSolutionGenerated; // Set by the GWO thread.
     bool isIterDisplayedChanged;
 
+    // Playback capture steps through every iteration of the current solutions,
+    // one iteration per frame, while the frames get captured.
+    eastl::string playbackCaptureFolder;
+    cx::FrameCaptureFormat playbackCaptureFormat;
+    bool isPlaybackCaptureRequested;
+    bool isCapturingPlayback;
+    bool isLaunchCapturePending; // Set if capturing was asked for at launch.
+
     void flashBestSolPosition(float timeDelta);
+    void generateSolutions();
+    bool shouldShowHeatmap();
+    void showWolfEntities(bool isHeatmapUsed);
+    void updateWolfEntities();
+    void updateWolfHeatmap(const cx::Point* wolves);
+    void updateWolfTrails();
+    bool isWolfTrailed(int32_t wolfIndex);
+    void toggleWolfTrail(int32_t wolfIndex);
+    void pickWolf(const cx::Point& screenPt);
+    void setPlaybackPosition(float position);
+    void advancePlayback(float timeDelta);
+    void requestPlaybackCapture(const eastl::string& outputFolder,
+                                cx::FrameCaptureFormat format);
+    void startPlaybackCapture();
+    void advancePlaybackCapture();
 
     void buildControls();
+    void buildMetricsPlots();
 
     void handleWindowEvents(const corex::core::WindowEvent& e);
+    void handleMouseButtonEvents(const corex::core::MouseButtonEvent& e);
   };
 }
 
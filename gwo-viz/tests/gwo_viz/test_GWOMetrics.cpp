@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+#include <pcg_random.hpp>
+
+#include <corex/core/ds/AABB.hpp>
+#include <corex/core/ds/Point.hpp>
+
+#include <gwo_viz/GWOMetrics.hpp>
+
+namespace
+{
+  using MetricGetter = float (*)(const gwo_viz::GWOIterationMetrics&);
+
+  // Every metric in GWOIterationMetrics.
+  const MetricGetter metricGetters[] = {
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.alphaFitness; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.meanFitness; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.worstFitness; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packCentroid.x; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packCentroid.y; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packRadius; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packBounds.minPt.x; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packBounds.minPt.y; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packBounds.maxPt.x; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.packBounds.maxPt.y; },
+    [](const gwo_viz::GWOIterationMetrics& m) { return m.preyDistance; }
+  };
+
+  std::vector<cx::Point> createPack(int32_t numWolves, uint32_t seed)
+  {
+    pcg32 rng{ seed };
+    std::uniform_real_distribution<float> distribution{ -50.f, 150.f };
+    std::vector<cx::Point> pack;
+    for (int32_t i = 0; i < numWolves; i++) {
+      const float x = distribution(rng);
+      const float y = distribution(rng);
+      pack.push_back(cx::Point{ x, y });
+    }
+
+    return pack;
+  }
+
+  float getDistance(const cx::Point& pt0, const cx::Point& pt1)
+  {
+    return std::hypot(pt1.x - pt0.x, pt1.y - pt0.y);
+  }
+
+  // Computes the metrics one wolf at a time, the obvious way.
+  gwo_viz::GWOIterationMetrics computeMetrics(
+    const std::vector<cx::Point>& pack,
+    cx::Point bestSolution,
+    cx::Point prey)
+  {
+    constexpr float kInfinity = std::numeric_limits<float>::infinity();
+    gwo_viz::GWOIterationMetrics metrics{
+      kInfinity,
+      0.f,
+      -kInfinity,
+      cx::Point{ 0.f, 0.f },
+      0.f,
+      cx::AABB{ pack[0], pack[0] },
+      getDistance(bestSolution, prey)
+    };
+    for (const cx::Point& wolf : pack) {
+      const float fitness = getDistance(bestSolution, wolf);
+      metrics.alphaFitness = std::min(metrics.alphaFitness, fitness);
+      metrics.meanFitness += fitness / pack.size();
+      metrics.worstFitness = std::max(metrics.worstFitness, fitness);
+      metrics.packCentroid.x += wolf.x / pack.size();
+      metrics.packCentroid.y += wolf.y / pack.size();
+      metrics.packBounds.minPt.x = std::min(metrics.packBounds.minPt.x,
+                                            wolf.x);
+      metrics.packBounds.minPt.y = std::min(metrics.packBounds.minPt.y,
+                                            wolf.y);
+      metrics.packBounds.maxPt.x = std::max(metrics.packBounds.maxPt.x,
+                                            wolf.x);
+      metrics.packBounds.maxPt.y = std::max(metrics.packBounds.maxPt.y,
+                                            wolf.y);
+    }
+
+    for (const cx::Point& wolf : pack) {
+      metrics.packRadius = std::max(metrics.packRadius,
+                                    getDistance(metrics.packCentroid, wolf));
+    }
+
+    return metrics;
+  }
+}
+
+TEST_CASE("GWOMetrics::add() matches a naive computation", "[GWOMetrics]")
+{
+  // Four wolves are reduced at a time, so these cover packs that only take
+  // the scalar tail, only the SIMD path, and both.
+  const int32_t numWolves = GENERATE(1, 3, 4, 7);
+  CAPTURE(numWolves);
+
+  const std::vector<cx::Point> pack = createPack(numWolves, 42u);
+  const cx::Point bestSolution{ 20.f, 30.f };
+  const cx::Point prey{ 25.f, 26.f };
+
+  gwo_viz::GWOMetrics metrics;
+  metrics.reset(1);
+  metrics.add(pack.data(), numWolves, bestSolution, prey);
+  REQUIRE(metrics.size() == 1);
+
+  const gwo_viz::GWOIterationMetrics expectedMetrics = computeMetrics(
+    pack, bestSolution, prey);
+  for (size_t i = 0; i < std::size(metricGetters); i++) {
+    CAPTURE(i);
+    REQUIRE(metricGetters[i](metrics.data()[0])
+            == Approx(metricGetters[i](expectedMetrics)).margin(1e-4));
+  }
+
+  // Every reserved iteration has been added, so more get ignored.
+  metrics.add(pack.data(), numWolves, bestSolution, prey);
+  REQUIRE(metrics.size() == 1);
+}
+
+TEST_CASE("GWOMetrics keeps the running extremes", "[GWOMetrics]")
+{
+  const int32_t numIterations = 6;
+  const cx::Point bestSolution{ 20.f, 30.f };
+
+  gwo_viz::GWOMetrics metrics;
+  metrics.reset(numIterations);
+
+  // Packs with no wolves don't count as an iteration.
+  metrics.add(nullptr, 0, bestSolution, bestSolution);
+  REQUIRE(metrics.size() == 0);
+
+  for (int32_t i = 0; i < numIterations; i++) {
+    const std::vector<cx::Point> pack = createPack(5 + i, 100u + i);
+    metrics.add(pack.data(), pack.size(), bestSolution, pack[0]);
+  }
+
+  REQUIRE(metrics.size() == numIterations);
+  for (int32_t i = 0; i < numIterations; i++) {
+    for (size_t j = 0; j < std::size(metricGetters); j++) {
+      CAPTURE(i, j);
+      float minValue = std::numeric_limits<float>::infinity();
+      float maxValue = -std::numeric_limits<float>::infinity();
+      for (int32_t k = 0; k <= i; k++) {
+        minValue = std::min(minValue, metricGetters[j](metrics.data()[k]));
+        maxValue = std::max(maxValue, metricGetters[j](metrics.data()[k]));
+      }
+
+      REQUIRE(metricGetters[j](metrics.getRunningMinimums()[i]) == minValue);
+      REQUIRE(metricGetters[j](metrics.getRunningMaximums()[i]) == maxValue);
+    }
+  }
+
+  // Resetting starts the extremes over.
+  metrics.reset(1);
+  const std::vector<cx::Point> pack = createPack(3, 7u);
+  metrics.add(pack.data(), pack.size(), bestSolution, pack[0]);
+  for (size_t j = 0; j < std::size(metricGetters); j++) {
+    CAPTURE(j);
+    REQUIRE(metricGetters[j](metrics.getRunningMinimums()[0])
+            == metricGetters[j](metrics.data()[0]));
+    REQUIRE(metricGetters[j](metrics.getRunningMaximums()[0])
+            == metricGetters[j](metrics.data()[0]));
+  }
+}
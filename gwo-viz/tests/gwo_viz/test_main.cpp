@@ -0,0 +1,16 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+
+#include <EASTL/unique_ptr.h>
+
+#include <corex/core/Application.hpp>
+
+namespace corex
+{
+  // corex-core's own main() expects the application to provide this. Catch
+  // brings its own main(), so this never gets called.
+  eastl::unique_ptr<corex::core::Application> createApplication()
+  {
+    return nullptr;
+  }
+}